@@ -0,0 +1,212 @@
+/*==============================================================================
+	ActivitySelector
+
+	Keeps a decaying activity score for each literal, bumped when the literal
+	is resolved upon or appears in a clause that subsumes another clause, and
+	selects the smallest waiting clause, preferring the one whose literals are
+	the most active, interleaved with the oldest waiting clause.
+
+	File			: activity_selector.h
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 19/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#ifndef ACTIVITY_SELECTOR_H_
+#define ACTIVITY_SELECTOR_H_
+
+#include <vector>
+
+#include "data_structures/clause_queue.h"
+
+class Clause;
+struct Literal;
+
+/*==============================================================================
+	ActivitySelector
+==============================================================================*/
+class ActivitySelector
+{
+public:
+	/*==========================================================================
+		Public Constructors/Deconstructor
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		ActivitySelector
+
+		Creates a new selector for literals with ranks up to the given rank,
+		all with an activity of zero, selecting the given number of clauses by
+		activity for each clause selected by age.
+	--------------------------------------------------------------------------*/
+	ActivitySelector(int, int);
+
+	/*==========================================================================
+		Public Functions
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		bumpLiteral
+
+		Increases the activity of the given literal and of its complement.
+	--------------------------------------------------------------------------*/
+	void bumpLiteral(const Literal*);
+
+	/*--------------------------------------------------------------------------
+		bumpClause
+
+		Increases the activity of every literal of the given clause.
+	--------------------------------------------------------------------------*/
+	void bumpClause(const Clause*);
+
+	/*--------------------------------------------------------------------------
+		decayActivities
+
+		Decays the activity of every literal by ACTIVITY_DECAY. This is done by
+		increasing the amount added by later bumps, and the activities are
+		rescaled when that amount grows too large.
+	--------------------------------------------------------------------------*/
+	void decayActivities();
+
+	/*--------------------------------------------------------------------------
+		addClause
+
+		Adds the given clause to both queues, scored by its current activity.
+	--------------------------------------------------------------------------*/
+	void addClause(Clause*);
+
+	/*--------------------------------------------------------------------------
+		getNext
+
+		Returns the next clause to resolve, or nullptr if no clauses are
+		waiting. Clauses are taken from the activity queue, with ties broken by
+		selecting the oldest clause, and every so often from the age queue as
+		for ClauseSelector. Every ACTIVITY_RESCORE_INTERVAL
+		selections the activity queue is rebuilt with the current activities,
+		dropping saturated and dead clauses.
+	--------------------------------------------------------------------------*/
+	Clause* getNext();
+
+	/*--------------------------------------------------------------------------
+		displayStatistics
+
+		Displays the number of bumps, of times the queue was rescored and of
+		clauses selected from each queue.
+	--------------------------------------------------------------------------*/
+	void displayStatistics() const;
+
+private:
+	/*==========================================================================
+		Private Types
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		An entry of the queue.
+	--------------------------------------------------------------------------*/
+	struct ScoredClause
+	{
+		double score;
+		int identifier;
+		Clause* clause;
+
+		inline bool operator<(const ScoredClause& that) const
+		{
+			// the heap is a max heap so the best clause must be greatest
+			if(score != that.score)
+			{
+				return score < that.score;
+			}
+			return identifier > that.identifier;
+		}
+	};
+
+	/*==========================================================================
+		Private Functions
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		score
+
+		Returns the mean activity of the literals of the given clause, relative
+		to the highest activity of any literal, less the size of the clause.
+		Smaller clauses are therefore always selected first, and the activity
+		decides between clauses of the same size.
+	--------------------------------------------------------------------------*/
+	double score(const Clause*) const;
+
+	/*--------------------------------------------------------------------------
+		rescore
+
+		Rebuilds the activity queue using the current activities.
+	--------------------------------------------------------------------------*/
+	void rescore();
+
+	/*--------------------------------------------------------------------------
+		popAge/popActivity
+
+		Remove and return the next waiting clause from the age or activity
+		queue, or nullptr if the queue holds no waiting clauses.
+	--------------------------------------------------------------------------*/
+	Clause* popAge();
+	Clause* popActivity();
+
+	/*==========================================================================
+		Private Member Variables
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		The activity of each literal, indexed by literal rank, the highest of
+		these activities, and the amount added to the activity of a literal
+		when it is bumped.
+	--------------------------------------------------------------------------*/
+	std::vector<double> activities;
+	double max_activity = 0.0;
+	double activity_increment = 1.0;
+
+	/*--------------------------------------------------------------------------
+		The number of clauses selected by activity for every clause selected
+		by age.
+	--------------------------------------------------------------------------*/
+	const int activity_ratio;
+
+	/*--------------------------------------------------------------------------
+		The clauses in order of increasing identifier, and a heap of the
+		waiting clauses ordered by score.
+	--------------------------------------------------------------------------*/
+	ClauseQueue age_queue;
+	std::vector<ScoredClause> queue;
+
+	/*--------------------------------------------------------------------------
+		The number of clauses selected since the queue was last rescored, and
+		the number selected by activity since a clause was last selected by
+		age.
+	--------------------------------------------------------------------------*/
+	int selections = 0;
+	int activity_selections = 0;
+
+	/*--------------------------------------------------------------------------
+		Statistics.
+	--------------------------------------------------------------------------*/
+	long bumps = 0;
+	int rescores = 0;
+	int selected_by_activity = 0;
+	int selected_by_age = 0;
+	int entries_skipped = 0;
+};
+
+#endif
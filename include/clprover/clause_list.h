@@ -4,7 +4,7 @@
 	File			: clause_list.h
 	Author			: Paul Gainer
 	Created			: 05/07/2014
-	Last modified	: 17/04/2015
+	Last modified	: 18/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -30,67 +30,144 @@
 #ifndef CLAUSE_LIST_H_
 #define CLAUSE_LIST_H_
 
-#include <functional>
 #include <list>
-#include <set>
+#include <vector>
 
 class Clause;
 class ClauseIndex;
 
 namespace clause_list
 {
+	/*--------------------------------------------------------------------------
+		sortByKey
+
+		Stably reorders the given clauses by the non-negative value of the
+		given key using a counting sort, with the second vector, of the same
+		size, used as scratch space.
+	--------------------------------------------------------------------------*/
+	template<typename Key>
+	void sortByKey(std::vector<Clause*>& clauses,
+		std::vector<Clause*>& sorted, Key key)
+	{
+		std::vector<int> counts;
+		for(Clause* c : clauses)
+		{
+			unsigned int k = key(c);
+			if(k >= counts.size())
+			{
+				counts.resize(k + 1, 0);
+			}
+			counts[k]++;
+		}
+		int position = 0;
+		for(int& count : counts)
+		{
+			int next_position = position + count;
+			count = position;
+			position = next_position;
+		}
+		for(Clause* c : clauses)
+		{
+			sorted[counts[key(c)]++] = c;
+		}
+		clauses.swap(sorted);
+	}
+
 	/*--------------------------------------------------------------------------
 		sortClauseList
 
 		Sorts the given clause list by type (UNIVERSAL < INTIAL < POSITIVE <
-		NEGATIVE), then disjunction size and finally conjunction size.
+		NEGATIVE), then disjunction size, then conjunction size and finally the
+		number of agents, using a stable radix sort.
 	--------------------------------------------------------------------------*/
 	void sortClauseList(std::list<Clause*>*);
 
 	/*--------------------------------------------------------------------------
 		backwardSubsumption
 
-		Removes from the given clause index all of the clauses that are subsumed
-		by a clause in the given list.
+		Lazily removes from the given clause index all of the clauses that are
+		subsumed by a clause in the given list. The subsumed clauses are marked
+		as dead, so they are also skipped when popped from a selection queue.
 	--------------------------------------------------------------------------*/
 	void backwardSubsumption(std::list<Clause*>*, ClauseIndex& clause_index);
 
 	/*--------------------------------------------------------------------------
-		backwardSubsumptionGetNext
+		batchBackwardSubsumption
 
-		Removes from the given clause index all of the clauses that are subsumed
-		by a clause in the given list. Removes all subsumed clauses from the
-		given sets.
+		Lazily removes from the given clause index all of the clauses that are
+		subsumed by a clause in the given batch, where the clauses of the batch
+		may already be stored in the index. Each bucket of the index that could
+		hold a subsumed clause is visited once for the whole batch.
 	--------------------------------------------------------------------------*/
-	void backwardSubsumptionGetNext(std::list<Clause*>*, ClauseIndex&,
-		std::set<Clause*, std::function<bool (Clause*, Clause*)>>*,
-		std::set<Clause*, std::function<bool (Clause*, Clause*)>>*,
-		std::set<Clause*, std::function<bool (Clause*, Clause*)>>*);
+	void batchBackwardSubsumption(std::list<Clause*>*, ClauseIndex&);
+
+	/*--------------------------------------------------------------------------
+		findSubsumer
+
+		Returns a live clause in the given clause index, other than the given
+		clause, that subsumes the given clause, or nullptr if there is none.
+	--------------------------------------------------------------------------*/
+	Clause* findSubsumer(Clause*, ClauseIndex&);
 
 	/*--------------------------------------------------------------------------
 		subsumption
 
 		Returns all the clauses in the given list that are not subsumed by
-		clauses in the given clause index.
+		clauses in the given clause index. Resolvents already checked against
+		the index when they were built are not checked again.
 	--------------------------------------------------------------------------*/
 	std::list<Clause*>* subsumption(std::list<Clause*>*, ClauseIndex&);
 
+	/*--------------------------------------------------------------------------
+		subsumptionResolution
+
+		Returns the clauses in the given list with every literal removed that
+		can be removed by subsumption resolution with a universal or initial
+		clause in the given clause index. Each clause that is reduced is
+		archived as the premise of the reduced clause.
+	--------------------------------------------------------------------------*/
+	std::list<Clause*>* subsumptionResolution(std::list<Clause*>*,
+		ClauseIndex&);
+
+	/*--------------------------------------------------------------------------
+		backwardSubsumptionResolution
+
+		Lazily removes from the given clause index all of the clauses from which
+		a literal can be removed by subsumption resolution with a universal or
+		initial clause in the given list, then adds the reduced clauses to the
+		end of the list.
+	--------------------------------------------------------------------------*/
+	void backwardSubsumptionResolution(std::list<Clause*>*, ClauseIndex&);
+
 	/*--------------------------------------------------------------------------
 		selfSubsumption
 
-		Removes from the given list all of the clauses that are not subsumed by
+		Removes from the given list all of the clauses that are subsumed by
 		another clause in the list.
 	--------------------------------------------------------------------------*/
-	std::list<Clause*>* selfSubsumption(std::list<Clause*>*, ClauseIndex&);
+	std::list<Clause*>* selfSubsumption(std::list<Clause*>*);
 
 	/*--------------------------------------------------------------------------
 		initialSelfSubsumption
 
-		Removes from the given list all of the clauses that are not subsumed by
-		another clause in the list.
+		Removes from the given list all of the clauses that are subsumed by
+		another clause in the list, using the subsumption relation for parsed
+		clauses.
 	--------------------------------------------------------------------------*/
-	std::list<Clause*>* initialSelfSubsumption(std::list<Clause*>*,
-		ClauseIndex&);
+	std::list<Clause*>* initialSelfSubsumption(std::list<Clause*>*);
+
+	/*--------------------------------------------------------------------------
+		batchSelfSubsumption
+
+		Sorts the given list then removes all of the clauses that are subsumed,
+		using the given subsumption relation, by an earlier clause in the list.
+		The surviving clauses are indexed by the maximal literal of their
+		disjunction, so each clause is only compared with the earlier surviving
+		clauses of a type that may subsume it, having as maximal literal one of
+		its literals, and with compatible literal signatures.
+	--------------------------------------------------------------------------*/
+	std::list<Clause*>* batchSelfSubsumption(std::list<Clause*>*,
+		bool (Clause::*)(Clause*));
 }
 
 #endif
@@ -0,0 +1,159 @@
+/*==============================================================================
+	ClauseSelector
+
+	Queues the clauses awaiting selection both by age and by weight, and
+	selects the next clause to resolve from the queues in a given ratio.
+
+	File			: clause_selector.h
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 18/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#ifndef CLAUSE_SELECTOR_H_
+#define CLAUSE_SELECTOR_H_
+
+#include <vector>
+
+#include "data_structures/clause_queue.h"
+
+class Clause;
+
+/*==============================================================================
+	ClauseSelector
+==============================================================================*/
+class ClauseSelector
+{
+public:
+	/*==========================================================================
+		Public Constructors/Deconstructor
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		ClauseSelector
+
+		Creates a new selector using the given weight function, that selects
+		the given number of clauses by weight for every clause selected by age.
+	--------------------------------------------------------------------------*/
+	ClauseSelector(int, int);
+
+	/*==========================================================================
+		Public Functions
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		addClause
+
+		Adds the given clause to the age and weight queues.
+	--------------------------------------------------------------------------*/
+	void addClause(Clause*);
+
+	/*--------------------------------------------------------------------------
+		getNext
+
+		Returns the next clause to resolve, or nullptr if no clauses are
+		waiting. A clause is left in the other queue when it is selected, and
+		such entries and those of dead clauses are skipped when they are
+		reached.
+	--------------------------------------------------------------------------*/
+	Clause* getNext();
+
+	/*--------------------------------------------------------------------------
+		weight
+
+		Returns the weight of the given clause under the given weight function.
+	--------------------------------------------------------------------------*/
+	static int weight(Clause*, int);
+
+	/*--------------------------------------------------------------------------
+		displayStatistics
+
+		Displays the number of clauses selected from each queue.
+	--------------------------------------------------------------------------*/
+	void displayStatistics() const;
+
+private:
+	/*==========================================================================
+		Private Types
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		An entry of the weight queue, ties between clauses of the same weight
+		are broken by the order in which the clauses were added.
+	--------------------------------------------------------------------------*/
+	struct WeightedClause
+	{
+		int weight;
+		unsigned long age;
+		Clause* clause;
+
+		inline bool operator<(const WeightedClause& that) const
+		{
+			// the heap is a max heap so the lightest clause must be greatest
+			return weight != that.weight ? weight > that.weight :
+				age > that.age;
+		}
+	};
+
+	/*==========================================================================
+		Private Functions
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		popAge/popWeight
+
+		Remove and return the next waiting clause from the age or weight queue,
+		or nullptr if the queue holds no waiting clauses.
+	--------------------------------------------------------------------------*/
+	Clause* popAge();
+	Clause* popWeight();
+
+	/*==========================================================================
+		Private Member Variables
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		The weight function and the number of clauses selected by weight for
+		every clause selected by age.
+	--------------------------------------------------------------------------*/
+	const int weight_function;
+	const int weight_ratio;
+
+	/*--------------------------------------------------------------------------
+		The clauses in order of increasing identifier, and a heap of the
+		clauses ordered by weight.
+	--------------------------------------------------------------------------*/
+	ClauseQueue age_queue;
+	std::vector<WeightedClause> weight_queue;
+
+	/*--------------------------------------------------------------------------
+		The number of clauses added so far, and the number of clauses selected
+		by weight since a clause was last selected by age.
+	--------------------------------------------------------------------------*/
+	unsigned long clauses_added = 0;
+	int weight_selections = 0;
+
+	/*--------------------------------------------------------------------------
+		Statistics.
+	--------------------------------------------------------------------------*/
+	int selected_by_age = 0;
+	int selected_by_weight = 0;
+	int entries_skipped = 0;
+};
+
+#endif
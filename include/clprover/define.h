@@ -4,7 +4,7 @@
 	File			: define.h
 	Author			: Paul Gainer
 	Created			: 22/06/2014
-	Last modified	: 17/04/2015
+	Last modified	: 18/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -35,6 +35,33 @@
 
 #define AGENT_NUM_NOT_SET -1
 
+// literal bitmasks are exact if there are no more than this many literals
+#define MAX_MASKED_LITERALS 128
+
+// the number of recent forward subsumers cached by each clause index
+#define SUBSUMER_CACHE_SIZE 16
+
+/* the initial and largest number of entries in the table of recently derived
+   resolvents, which doubles in size whenever more resolvents have been
+   recorded in it than it has entries */
+#define RECENT_RESOLVENT_MIN_TABLE_SIZE 1024
+#define RECENT_RESOLVENT_MAX_TABLE_SIZE 65536
+
+/* the percentage of dead clauses in a clause index or selection queue above
+   which the dead clauses are unlinked */
+#define DEAD_CLAUSE_COMPACTION_PERCENT 25
+
+// the number of applications of a simplification in an adaptive window
+#define ADAPTIVE_WINDOW_SIZE 32
+
+/* a simplification is throttled if it removes fewer than one clause for every
+   this many candidates checked */
+#define ADAPTIVE_MIN_YIELD 1000
+
+/* the number of clauses in a batch awaiting backward subsumption at which the
+   batch is applied early */
+#define BACKWARD_BATCH_MAX_CLAUSES 1024
+
 // we use 3 features to characterize a clause
 #define NUM_FEATURES 3
 // there are 4 different types of clause
@@ -49,6 +76,66 @@
 // heuristic defines
 #define GET_NEXT_SMALLEST 0
 #define GET_NEXT 1
+#define AGE_WEIGHT 2
+#define LITERAL_ACTIVITY 3
+#define GOAL_DISTANCE 4
+
+// literal activity defines
+#define ACTIVITY_DECAY 0.95
+#define ACTIVITY_RESCALE_LIMIT 1e100
+#define ACTIVITY_RESCORE_INTERVAL 64
+
+// goal distance defines
+#define GOAL_RESCORE_INTERVAL 64
+
+// set of support defines
+#define SOS_DISABLED 0
+#define SOS_COMPLETE 1
+#define SOS_INCOMPLETE 2
+
+// clause weight function defines
+#define WEIGHT_SYMBOL_COUNT 0
+#define WEIGHT_TYPE_SIZE 1
+#define WEIGHT_AGENT_PENALTY 2
+#define WEIGHT_MAX_LITERAL 3
+
+// the weight of each literal of a clause of each type for WEIGHT_TYPE_SIZE
+#define TYPE_WEIGHT_UNIVERSAL 1
+#define TYPE_WEIGHT_INITIAL 2
+#define TYPE_WEIGHT_COALITION 3
+
+// the weight added for each agent of a coalition for WEIGHT_AGENT_PENALTY
+#define AGENT_WEIGHT_PENALTY 2
+
+// literal selection defines
+#define SELECT_MAXIMAL 0
+#define SELECT_NEGATIVE 1
+#define SELECT_FEWEST_OCCURRENCES 2
+#define SELECT_ALL_NEGATIVE 3
+
+// literal ordering defines
+#define ORDER_INPUT 0
+#define ORDER_FREQUENCY 1
+#define ORDER_INITIAL_FIRST 2
+#define ORDER_CUTHILL_MCKEE 3
+#define ORDER_TUNED 4
+
+// literal ordering tuning defines
+#define TUNE_PROBE_GIVEN_CLAUSES 500
+
+// clause splitting defines
+#define SPLIT_DISABLED 0
+#define SPLIT_MIN_LENGTH 3
+#define SPLIT_NAME_PREFIX "_s"
+
+// symmetry defines
+#define SYMMETRY_DISABLED 0
+#define SYMMETRY_MAX_GENERATORS 64
+#define SYMMETRY_SEARCH_BUDGET 1024
+
+// given clause loop defines
+#define OTTER_LOOP 0
+#define DISCOUNT_LOOP 1
 
 // dividers
 #define DIVIDER_0  "================================================================================\n"
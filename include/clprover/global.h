@@ -4,7 +4,7 @@
 	File			: global.h
 	Author			: Paul Gainer
 	Created			: 22/06/2014
-	Last modified	: 18/04/2015
+	Last modified	: 18/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -38,18 +38,33 @@
 
 #include "data_structures/clause.h"
 
+class ActivitySelector;
+
 extern const std::string EXEC_VERSION;
 extern const std::string EXEC_NAME;
 
 extern std::list<Clause*>* g_archive;
 extern std::vector<Literal*>* g_literals;
+extern std::set<int>* g_support_clauses;
 extern Clause* g_contradiction;
+extern ActivitySelector* g_activity_selector;
 extern int g_heuristic;
+extern int g_loop_style;
+extern int g_literal_selection;
+extern int g_literal_ordering;
+extern int g_split_length;
+extern int g_symmetry_length;
+extern int g_weight_function;
+extern int g_weight_ratio;
+extern int g_set_of_support;
 extern int g_num_agents;
+extern int g_backward_batch_size;
 extern int g_verbosity;
 extern int g_inference_count_tautology;
 extern int g_inference_count_ires1;
 extern int g_inference_count_gres1;
+extern int g_inference_count_hres;
+extern int g_hres_subsumed_partials;
 extern int g_inference_count_cres1;
 extern int g_inference_count_cres2;
 extern int g_inference_count_cres3;
@@ -57,10 +72,23 @@ extern int g_inference_count_cres4;
 extern int g_inference_count_cres5;
 extern int g_backward_subsumed_count;
 extern int g_forward_subsumed_count;
+extern int g_given_subsumed_count;
+extern long g_backward_subsumption_candidates;
+extern int g_forward_subsumption_resolutions;
+extern int g_backward_subsumption_resolutions;
+extern long g_sos_skipped_partners;
+extern int g_sos_reopened_clauses;
+extern int g_coalition_merges_skipped;
+extern int g_subsumer_cache_hits;
+extern int g_subsumer_cache_misses;
+extern int g_batch_duplicate_resolvents;
+extern int g_recent_duplicate_resolvents;
 extern int g_rewrite_count;
 extern int g_unit_propagation_clauses_removed;
 extern int g_unit_propagation_literals_removed;
 extern int g_purity_deletion_clauses_eliminated;
+extern int g_split_clauses;
+extern int g_split_names;
 extern bool g_increment_literal_ranks;
 extern bool g_display_extra_inference_information;
 extern bool g_display_modality_as_vector;
@@ -68,5 +96,11 @@ extern bool g_unit_propagation;
 extern bool g_purity_deletion;
 extern bool g_forward_subsumption;
 extern bool g_backward_subsumption;
+extern bool g_subsumption_resolution;
+extern bool g_coalition_support;
+extern bool g_hyperresolution;
+extern bool g_adaptive_scheduling;
+extern bool g_literal_masks;
+extern bool g_unified_index;
 
 #endif
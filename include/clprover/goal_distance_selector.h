@@ -0,0 +1,174 @@
+/*==============================================================================
+	GoalDistanceSelector
+
+	Maintains the distance of each literal from the literals of the initial
+	clauses in a graph linking the literals that occur together in a clause
+	and each literal with its complement, and selects the waiting clause that
+	is closest to the initial clauses, taking its size into account.
+
+	File			: goal_distance_selector.h
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 18/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#ifndef GOAL_DISTANCE_SELECTOR_H_
+#define GOAL_DISTANCE_SELECTOR_H_
+
+#include <set>
+#include <vector>
+
+class Clause;
+
+/*==============================================================================
+	GoalDistanceSelector
+==============================================================================*/
+class GoalDistanceSelector
+{
+public:
+	/*==========================================================================
+		Public Constructors/Deconstructor
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		GoalDistanceSelector
+
+		Creates a new selector for literals with ranks up to the given rank.
+		Initially no literal is reachable from an initial clause.
+	--------------------------------------------------------------------------*/
+	GoalDistanceSelector(int);
+
+	/*==========================================================================
+		Public Functions
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		addClause
+
+		Adds the literals of the given clause to the literal graph, updates the
+		distances that become shorter and queues the clause.
+	--------------------------------------------------------------------------*/
+	void addClause(Clause*);
+
+	/*--------------------------------------------------------------------------
+		getNext
+
+		Returns the waiting clause with the smallest sum of goal distance and
+		size, or nullptr if no clauses are waiting. Ties are broken by selecting
+		the oldest clause. If distances have become shorter, the queue is
+		rebuilt with the current distances before the first selection and then
+		at most every GOAL_RESCORE_INTERVAL selections.
+	--------------------------------------------------------------------------*/
+	Clause* getNext();
+
+	/*--------------------------------------------------------------------------
+		displayStatistics
+
+		Displays the number of distance updates and of times the queue was
+		rescored.
+	--------------------------------------------------------------------------*/
+	void displayStatistics() const;
+
+private:
+	/*==========================================================================
+		Private Types
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		An entry of the queue.
+	--------------------------------------------------------------------------*/
+	struct ScoredClause
+	{
+		int score;
+		int identifier;
+		Clause* clause;
+
+		inline bool operator<(const ScoredClause& that) const
+		{
+			// the heap is a max heap so the best clause must be greatest
+			return score != that.score ? score > that.score :
+				identifier > that.identifier;
+		}
+	};
+
+	/*==========================================================================
+		Private Functions
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		score
+
+		Returns the smallest distance of a literal of the given clause plus the
+		size of the clause.
+	--------------------------------------------------------------------------*/
+	int score(const Clause*) const;
+
+	/*--------------------------------------------------------------------------
+		lowerDistance
+
+		Sets the distance of the literal with the given rank to the given
+		distance if that is shorter, then shortens the distances of the
+		literals reachable from it.
+	--------------------------------------------------------------------------*/
+	void lowerDistance(int, int);
+
+	/*--------------------------------------------------------------------------
+		rescore
+
+		Rebuilds the queue using the current distances.
+	--------------------------------------------------------------------------*/
+	void rescore();
+
+	/*==========================================================================
+		Private Member Variables
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		The distance used for literals not reachable from an initial clause.
+	--------------------------------------------------------------------------*/
+	const int unreachable;
+
+	/*--------------------------------------------------------------------------
+		The distance of each literal, the literals linked to each literal and
+		the complement of each literal, all indexed by literal rank.
+	--------------------------------------------------------------------------*/
+	std::vector<int> distances;
+	std::vector<std::set<int>> links;
+	std::vector<int> complements;
+
+	/*--------------------------------------------------------------------------
+		A heap of the waiting clauses ordered by score.
+	--------------------------------------------------------------------------*/
+	std::vector<ScoredClause> queue;
+
+	/*--------------------------------------------------------------------------
+		True if a distance has become shorter since the queue was last
+		rescored, and the number of clauses selected since then.
+	--------------------------------------------------------------------------*/
+	bool distances_changed = false;
+	int selections;
+
+	/*--------------------------------------------------------------------------
+		Statistics.
+	--------------------------------------------------------------------------*/
+	long distance_updates = 0;
+	int rescores = 0;
+	int entries_skipped = 0;
+};
+
+#endif
@@ -0,0 +1,129 @@
+/*==============================================================================
+	A collection of functions that generate and apply orderings on the
+	literals of a list of clauses.
+
+	File			: literal_ordering.h
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 18/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#ifndef LITERAL_ORDERING_H_
+#define LITERAL_ORDERING_H_
+
+#include <climits>
+#include <list>
+#include <string>
+#include <vector>
+
+class Clause;
+class Literal;
+
+namespace literal_ordering
+{
+	/*--------------------------------------------------------------------------
+		ProbeResult
+
+		The progress made by a probing run of resolution, stopped after
+		TUNE_PROBE_GIVEN_CLAUSES given clauses.
+	--------------------------------------------------------------------------*/
+	struct ProbeResult
+	{
+		// true if a contradiction was derived or the clauses were saturated
+		bool finished = false;
+		int given_clauses = 0;
+		int smallest_resolvent = INT_MAX;
+		int passive_clauses = 0;
+		int inferences = 0;
+		int subsumed_resolvents = 0;
+
+		/*----------------------------------------------------------------------
+			operator <
+
+			A run is better than another if it finished after fewer given
+			clauses, and otherwise if it derived a smaller resolvent, has fewer
+			passive clauses or has a larger share of its resolvents forward
+			subsumed, in that order.
+		----------------------------------------------------------------------*/
+		inline bool operator<(const ProbeResult& that) const
+		{
+			if(finished != that.finished)
+			{
+				return finished;
+			}
+			if(finished)
+			{
+				return given_clauses < that.given_clauses;
+			}
+			if(smallest_resolvent != that.smallest_resolvent)
+			{
+				return smallest_resolvent < that.smallest_resolvent;
+			}
+			if(passive_clauses != that.passive_clauses)
+			{
+				return passive_clauses < that.passive_clauses;
+			}
+			return static_cast<long>(subsumed_resolvents) * that.inferences >
+				static_cast<long>(that.subsumed_resolvents) * inferences;
+		}
+	};
+
+	/*--------------------------------------------------------------------------
+		generateOrdering
+
+		Returns the positive literals of the given clauses, greatest first,
+		ordered by the given generator.
+		ORDER_FREQUENCY puts the literals that occur least often first, so
+		that the fewest resolvents are derived from each literal resolved upon.
+		ORDER_INITIAL_FIRST puts the literals of the initial clauses first,
+		followed by the others in order of their distance from those literals
+		in the graph linking each clause to its literals.
+		ORDER_CUTHILL_MCKEE uses the reverse Cuthill-McKee ordering of that
+		graph, which gives literals occurring together nearby ranks.
+		Ties are broken by the current ranks, and ORDER_INPUT returns the
+		current ordering.
+	--------------------------------------------------------------------------*/
+	std::vector<Literal*> generateOrdering(std::list<Clause*>*, int);
+
+	/*--------------------------------------------------------------------------
+		applyOrdering
+
+		Ranks the literals in the given order of positive literals, greatest
+		first, with each negative literal immediately above its complement.
+		The parsed literals and the literals of the given clauses and of the
+		archived clauses are sorted by their new ranks, and the bitmasks of
+		the given clauses are rebuilt if they are in use.
+	--------------------------------------------------------------------------*/
+	void applyOrdering(const std::vector<Literal*>&, std::list<Clause*>*);
+
+	/*--------------------------------------------------------------------------
+		writeOrderingFile
+
+		Writes the current ordering of the parsed literals to the file with the
+		given name, in the format read by parseOrderingFile. Returns false if
+		the file could not be written.
+	--------------------------------------------------------------------------*/
+	bool writeOrderingFile(const std::string&);
+}
+
+#endif
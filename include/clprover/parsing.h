@@ -4,7 +4,7 @@
 	File			: parsing.h
 	Author			: Paul Gainer
 	Created			: 22/06/2014
-	Last modified	: 16/09/2014
+	Last modified	: 18/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -48,6 +48,14 @@
 ------------------------------------------------------------------------------*/
 bool parseOrderingFile(const std::string&);
 
+/*------------------------------------------------------------------------------
+	parseSupportFile
+
+	Parses a file listing the identifiers of input clauses, separated by
+	commas, that are added to the set of support.
+------------------------------------------------------------------------------*/
+bool parseSupportFile(const std::string&);
+
 /*------------------------------------------------------------------------------
 	parseInputFile
 
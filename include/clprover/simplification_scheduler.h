@@ -0,0 +1,157 @@
+/*==============================================================================
+	SimplificationScheduler
+
+	Measures the cost and benefit of applying a simplification against a clause
+	index over a sliding window of applications, and adapts the size of the
+	largest clause that takes part in the simplification.
+
+	File			: simplification_scheduler.h
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 18/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#ifndef SIMPLIFICATION_SCHEDULER_H_
+#define SIMPLIFICATION_SCHEDULER_H_
+
+#include <ctime>
+#include <list>
+#include <string>
+
+class Clause;
+
+/*==============================================================================
+	SimplificationScheduler
+==============================================================================*/
+class SimplificationScheduler
+{
+public:
+	/*==========================================================================
+		Public Constructors/Deconstructor
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		SimplificationScheduler
+
+		Creates a new scheduler with the given name, used when displaying
+		statistics. Initially every clause takes part in the simplification.
+	--------------------------------------------------------------------------*/
+	SimplificationScheduler(const std::string&);
+
+	/*--------------------------------------------------------------------------
+		~SimplificationScheduler
+	--------------------------------------------------------------------------*/
+	~SimplificationScheduler();
+
+	/*==========================================================================
+		Accessors/Mutators
+	==========================================================================*/
+	inline int getSizeLimit() const {return size_limit;}
+
+	/*==========================================================================
+		Public Functions
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		selectClauses
+
+		Returns the clauses in the given list having a size no more than the
+		current size limit, and starts measuring an application of the
+		simplification.
+	--------------------------------------------------------------------------*/
+	std::list<Clause*>* selectClauses(std::list<Clause*>*);
+
+	/*--------------------------------------------------------------------------
+		recordApplication
+
+		Finishes measuring an application of the simplification, given the
+		number of candidate clauses that were checked and the number of clauses
+		that were removed. Once a full window of applications has been recorded
+		the size limit is halved if fewer than one clause was removed for every
+		ADAPTIVE_MIN_YIELD candidates in the window, and otherwise increased
+		by one.
+	--------------------------------------------------------------------------*/
+	void recordApplication(long, int);
+
+	/*--------------------------------------------------------------------------
+		displayStatistics
+
+		Displays the measured cost and benefit of the simplification and the
+		decisions taken by the scheduler.
+	--------------------------------------------------------------------------*/
+	void displayStatistics() const;
+
+private:
+	/*==========================================================================
+		Private Member Variables
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		The name of the simplification and the index it is applied against.
+	--------------------------------------------------------------------------*/
+	const std::string name;
+
+	/*--------------------------------------------------------------------------
+		The size of the largest clause that takes part in the simplification.
+	--------------------------------------------------------------------------*/
+	int size_limit;
+
+	/*--------------------------------------------------------------------------
+		The size of the largest clause offered to the scheduler.
+	--------------------------------------------------------------------------*/
+	int max_clause_size = 0;
+
+	/*--------------------------------------------------------------------------
+		The number of candidates checked and clauses removed by each
+		application in the window, stored in a ring.
+	--------------------------------------------------------------------------*/
+	long* window_candidates;
+	int* window_removed;
+
+	/*--------------------------------------------------------------------------
+		The position in the ring of the next application.
+	--------------------------------------------------------------------------*/
+	int window_position = 0;
+
+	/*--------------------------------------------------------------------------
+		The totals over the applications currently in the window.
+	--------------------------------------------------------------------------*/
+	long window_candidates_total = 0;
+	int window_removed_total = 0;
+
+	/*--------------------------------------------------------------------------
+		The time at which the current application started.
+	--------------------------------------------------------------------------*/
+	clock_t application_start = 0;
+
+	/*--------------------------------------------------------------------------
+		Statistics.
+	--------------------------------------------------------------------------*/
+	int applications = 0;
+	int clauses_selected = 0;
+	int clauses_skipped = 0;
+	long candidates = 0;
+	int removed = 0;
+	clock_t time = 0;
+	int times_lowered = 0;
+	int times_raised = 0;
+};
+
+#endif
@@ -0,0 +1,188 @@
+/*==============================================================================
+	SymmetryDetector
+
+	Detects permutations of the propositions of a clause set that map the set
+	onto itself, as automorphisms of a graph linking each clause to the
+	propositions occurring in it, and adds the images of derived clauses under
+	those permutations without resolving them.
+
+	File			: symmetry_detector.h
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 18/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#ifndef SYMMETRY_DETECTOR_H_
+#define SYMMETRY_DETECTOR_H_
+
+#include <list>
+#include <set>
+#include <utility>
+#include <vector>
+
+class Clause;
+class Literal;
+
+/*==============================================================================
+	SymmetryDetector
+==============================================================================*/
+class SymmetryDetector
+{
+public:
+	/*==========================================================================
+		Public Constructors/Deconstructor
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		SymmetryDetector
+
+		Creates a new detector for the given maximal clause size. Initially no
+		symmetries are known.
+	--------------------------------------------------------------------------*/
+	SymmetryDetector(int);
+
+	/*==========================================================================
+		Public Functions
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		detectSymmetries
+
+		Searches for permutations of the propositions of the given clauses,
+		preserving the polarity of each literal, that map the clauses onto
+		themselves. The search is refined by the clause types, agents and
+		sizes, and gives up once SYMMETRY_SEARCH_BUDGET partial permutations
+		have been tried or SYMMETRY_MAX_GENERATORS symmetries have been found.
+	--------------------------------------------------------------------------*/
+	void detectSymmetries(std::list<Clause*>*);
+
+	/*--------------------------------------------------------------------------
+		addImages
+
+		Adds to the given list the image of the given clause under each known
+		symmetry, unless the clause is an input clause, is larger than the
+		maximal clause size or is mapped onto itself. The images are
+		justified by the given clause and rule SYM.
+	--------------------------------------------------------------------------*/
+	void addImages(Clause*, std::list<Clause*>*);
+
+	/*--------------------------------------------------------------------------
+		displayStatistics
+
+		Displays the number of symmetries found, of partial permutations tried
+		and of images added.
+	--------------------------------------------------------------------------*/
+	void displayStatistics() const;
+
+private:
+	/*==========================================================================
+		Private Functions
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		refine
+
+		Refines the given pair of colourings of the graph in step until each
+		vertex of a colour has the same colours of neighbours. Returns false if
+		the colours of the two colourings are not of equal sizes, in which case
+		no permutation maps the first onto the second.
+	--------------------------------------------------------------------------*/
+	bool refine(std::vector<int>&, std::vector<int>&);
+
+	/*--------------------------------------------------------------------------
+		search
+
+		Searches for a symmetry mapping each proposition of the first colouring
+		to the proposition of the same colour in the second, individualising
+		a proposition of the first colour of several propositions together
+		with each of its candidate images in turn. Returns true and sets the
+		given permutation of literal ranks if one is found.
+	--------------------------------------------------------------------------*/
+	bool search(std::vector<int>&, std::vector<int>&, std::vector<int>&);
+
+	/*--------------------------------------------------------------------------
+		literalPermutation
+
+		Returns the permutation of literal ranks mapping the literals of each
+		proposition to those of its image under the given permutation of the
+		propositions.
+	--------------------------------------------------------------------------*/
+	std::vector<int> literalPermutation(const std::vector<int>&) const;
+
+	/*--------------------------------------------------------------------------
+		clauseKey
+
+		Returns a key identifying the given clause, with each literal replaced
+		by its image under the given permutation of literal ranks if this is
+		not null.
+	--------------------------------------------------------------------------*/
+	std::vector<int> clauseKey(const Clause*, const std::vector<int>*) const;
+
+	/*--------------------------------------------------------------------------
+		displayGenerator
+
+		Displays the given permutation of literal ranks in cycle notation,
+		showing only the positive literals.
+	--------------------------------------------------------------------------*/
+	void displayGenerator(const std::vector<int>&) const;
+
+	/*==========================================================================
+		Private Member Variables
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		The largest clause whose images are added.
+	--------------------------------------------------------------------------*/
+	const int max_size;
+
+	/*--------------------------------------------------------------------------
+		The graph, whose first vertices are the propositions and whose other
+		vertices are the clauses. Each edge is labelled by the side of the
+		clause on which the proposition occurs and by its polarity.
+	--------------------------------------------------------------------------*/
+	int num_propositions = 0;
+	std::vector<std::vector<std::pair<int, int>>> edges;
+
+	/*--------------------------------------------------------------------------
+		The positive literal of each proposition, and the literal with each
+		rank.
+	--------------------------------------------------------------------------*/
+	std::vector<Literal*> propositions;
+	std::vector<Literal*> literals;
+
+	/*--------------------------------------------------------------------------
+		The keys of the clauses, used to check candidate permutations.
+	--------------------------------------------------------------------------*/
+	const std::list<Clause*>* clauses = nullptr;
+	std::set<std::vector<int>> clause_keys;
+
+	/*--------------------------------------------------------------------------
+		The symmetries found, each mapping every literal rank to the rank of
+		its image.
+	--------------------------------------------------------------------------*/
+	std::vector<std::vector<int>> generators;
+
+	/*--------------------------------------------------------------------------
+		Statistics.
+	--------------------------------------------------------------------------*/
+	int search_nodes = 0;
+	int images_added = 0;
+};
+
+#endif
@@ -8,7 +8,7 @@
 	File			: clause.h
 	Author			: Paul Gainer
 	Created			: 16/06/2014
-	Last modified	: 16/09/2014
+	Last modified	: 19/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -34,6 +34,7 @@
 #ifndef CLAUSE_H_
 #define CLAUSE_H_
 
+#include <cstdint>
 #include <list>
 #include <vector>
 #include <string>
@@ -63,10 +64,13 @@ public:
 
 		Constructs and returns a new clause. If the right side conjunction is
 		empty and this is a coalition clause then archive this clause and
-		return the rewritten universal clause instead.
+		return the rewritten universal clause instead. If the final argument is
+		false then the clause is given a provisional identifier, to be replaced
+		by assignIdentifier only if the clause survives simplification, and a
+		rewritten coalition clause is only archived at that point.
 	--------------------------------------------------------------------------*/
 	Clause(LiteralList*, std::list<int>*, LiteralList*, ClauseType,
-		Justification*, std::vector<int>*);
+		Justification*, std::vector<int>*, bool = true);
 
 	/*--------------------------------------------------------------------------
 		~Clause
@@ -88,8 +92,11 @@ public:
 		Accessors/Mutators
 	==========================================================================*/
 	inline int getIdentifier() const {return identifier;}
+	inline bool hasIdentifier() const {return identifier > 0;}
 	inline LiteralList* getLeft() const {return left;}
 	inline std::list<int>* getAgents() const {return agents;}
+	inline std::vector<int>* getCoalitionVector() const
+		{return coalition_vector;}
 	inline LiteralList* getRight() const {return right;}
 	inline ClauseType getClauseType() const	{return clause_type;}
 	inline Justification* getJustification() const {return justification;}
@@ -108,6 +115,48 @@ public:
 	inline bool isActive() const {return active;}
 	inline void setActive() {active = true;}
 	inline void setInactive() {active = false;}
+	/*--------------------------------------------------------------------------
+		isSaturated
+
+		Returns true if this clause has been selected and resolved, that is if
+		it is in the saturated set rather than the set awaiting selection.
+	--------------------------------------------------------------------------*/
+	inline bool isSaturated() const {return saturated;}
+	/*--------------------------------------------------------------------------
+		isDead
+
+		Returns true if this clause has been removed from its clause index but
+		may still be linked into the index and into the selection queues.
+	--------------------------------------------------------------------------*/
+	inline bool isDead() const {return dead;}
+
+	/*--------------------------------------------------------------------------
+		getSubsumptionCheckedIndex
+
+		Returns the clause index against which this resolvent was checked for
+		forward subsumption before it was built, or null.
+	--------------------------------------------------------------------------*/
+	inline const ClauseIndex* getSubsumptionCheckedIndex() const
+		{return subsumption_checked_index;}
+	/*--------------------------------------------------------------------------
+		isSupported/setSupported
+
+		A clause is supported if it is in the set of support. Clauses are
+		supported unless the set of support strategy removes them.
+	--------------------------------------------------------------------------*/
+	inline bool isSupported() const {return supported;}
+	inline void setSupported(const bool value) {supported = value;}
+	/*--------------------------------------------------------------------------
+		hasSelectedLiterals
+
+		Returns true if literals of the disjunction of this clause are selected,
+		in which case the clause is only resolved upon those literals rather
+		than upon its maximal literal.
+	--------------------------------------------------------------------------*/
+	inline bool hasSelectedLiterals() const
+	{
+		return selected_literals != nullptr;
+	}
 
 	/*==========================================================================
 		Public Functions
@@ -125,6 +174,29 @@ public:
 			coalition_vector = new std::vector<int>();
 		}
 		coalition_vector->push_back(i);
+		addMoveToShape(coalition_vector->size() - 1, i);
+	}
+
+	/*--------------------------------------------------------------------------
+		mayMergeCoalitions
+
+		Returns false if the coalition vector of this clause certainly cannot
+		be merged with the coalition vector of the given clause, using only the
+		shapes of the vectors. Returns true if mergeCoalitions must decide.
+
+		A merge is impossible if the vectors have different negative moves, or
+		if a position holds a positive move in one vector and a negative move
+		in the other.
+	--------------------------------------------------------------------------*/
+	inline bool mayMergeCoalitions(const Clause* that) const
+	{
+		if(negative_move != 0 && that->negative_move != 0 &&
+			negative_move != that->negative_move)
+		{
+			return false;
+		}
+		return ((positive_positions & that->negative_positions) |
+			(negative_positions & that->positive_positions)) == 0;
 	}
 
 	/*--------------------------------------------------------------------------
@@ -151,6 +223,14 @@ public:
 	--------------------------------------------------------------------------*/
 	int* calculateFeatures();
 
+	/*--------------------------------------------------------------------------
+		selects
+
+		Returns true if the given literal is selected in the disjunction of this
+		clause.
+	--------------------------------------------------------------------------*/
+	bool selects(const Literal*) const;
+
 	/*--------------------------------------------------------------------------
 		displayClause
 
@@ -196,6 +276,34 @@ public:
 	--------------------------------------------------------------------------*/
 	bool initialSubsumes(Clause*);
 
+	/*--------------------------------------------------------------------------
+		mayForwardSubsume
+
+		Returns true if a clause of the type of this clause is permitted to
+		forward subsume a clause of the type of the given clause.
+	--------------------------------------------------------------------------*/
+	bool mayForwardSubsume(Clause*) const;
+
+	/*--------------------------------------------------------------------------
+		subsumptionResolves
+
+		Returns the literal in the disjunction of the given clause that can be
+		removed by subsumption resolution with this clause, or null if there is
+		none. If C_R is the disjunction of a clause C then a literal l can be
+		removed from C'_R if C_R = D \cup \{\neg l\} and D \subseteq C'_R
+		and C is universal, or if both C and C' are initial clauses.
+	--------------------------------------------------------------------------*/
+	Literal* subsumptionResolves(Clause*);
+
+	/*--------------------------------------------------------------------------
+		subsumptionResolvent
+
+		Returns a copy of this clause with the given literal removed from its
+		disjunction, justified by subsumption resolution with the given clause.
+		The copy is given a provisional identifier.
+	--------------------------------------------------------------------------*/
+	Clause* subsumptionResolvent(Clause*, Literal*);
+
 	/*--------------------------------------------------------------------------
 		relativeComplementAgents
 
@@ -242,6 +350,26 @@ public:
 	--------------------------------------------------------------------------*/
 	void nullifyLeft();
 
+	/*--------------------------------------------------------------------------
+		calculateLiteralMasks
+
+		Rebuilds the literal bitmasks of the conjunction and disjunction.
+	--------------------------------------------------------------------------*/
+	inline void calculateLiteralMasks()
+	{
+		left->calculateMask();
+		right->calculateMask();
+	}
+
+	/*--------------------------------------------------------------------------
+		assignIdentifier
+
+		Replaces the provisional identifier of this clause with the next unused
+		clause identifier. If this clause was rewritten from a coalition clause
+		then that clause is given the identifier before it and archived.
+	--------------------------------------------------------------------------*/
+	void assignIdentifier();
+
 	/*==========================================================================
 		Public Static Functions
 	==========================================================================*/
@@ -252,6 +380,24 @@ public:
 	--------------------------------------------------------------------------*/
 	inline static int getNextIdentifier() {return next_identifier;}
 
+	/*--------------------------------------------------------------------------
+		setNextIdentifier
+
+		Sets the next unused clause identifier, used to reuse the identifiers
+		of clauses that have been discarded.
+	--------------------------------------------------------------------------*/
+	inline static void setNextIdentifier(const int identifier)
+		{next_identifier = identifier;}
+
+	/*--------------------------------------------------------------------------
+		assignIdentifiers
+
+		Replaces the provisional identifiers of the clauses in the given list
+		with the next unused clause identifiers, in the order in which the
+		clauses were constructed.
+	--------------------------------------------------------------------------*/
+	static void assignIdentifiers(std::list<Clause*>*);
+
 private:
 	/*==========================================================================
 		Private Constants
@@ -264,7 +410,7 @@ private:
 	/*--------------------------------------------------------------------------
 		String representations of the inference rules.
 	--------------------------------------------------------------------------*/
-	static const std::string INFERENCE_RULE_STRINGS[9];
+	static const std::string INFERENCE_RULE_STRINGS[13];
 
 	/*==========================================================================
 		Private Static Member Variables
@@ -274,6 +420,13 @@ private:
 	--------------------------------------------------------------------------*/
 	static int next_identifier;
 
+	/*--------------------------------------------------------------------------
+		The next unused provisional clause identifier. Provisional identifiers
+		are negative and decrease in the order in which clauses are
+		constructed.
+	--------------------------------------------------------------------------*/
+	static int next_provisional_identifier;
+
 	/*==========================================================================
 		Private Member Variables
 	==========================================================================*/
@@ -287,6 +440,29 @@ private:
 	--------------------------------------------------------------------------*/
 	std::vector<int>* coalition_vector;
 
+	/*--------------------------------------------------------------------------
+		The shape of the coalition vector: bitmasks of the positions holding
+		positive and negative moves, and the negative move (or 0 if there is
+		none). Only the first 64 positions are recorded.
+	--------------------------------------------------------------------------*/
+	uint64_t positive_positions;
+	uint64_t negative_positions;
+	int negative_move;
+
+	/*--------------------------------------------------------------------------
+		A signature of the coalition vector, with one bit set for the hash of
+		each position and non-zero move. If a coalition vector V subsumes V'
+		then the signature of V is a subset of the signature of V'.
+	--------------------------------------------------------------------------*/
+	uint64_t coalition_signature;
+
+	/*--------------------------------------------------------------------------
+		A signature of the list of agents, with bit (a mod 64) set for each
+		agent a. If a list of agents is a subset of another then so is its
+		signature.
+	--------------------------------------------------------------------------*/
+	uint64_t agent_signature;
+
 	/*--------------------------------------------------------------------------
 		The left side conjunction.
 	--------------------------------------------------------------------------*/
@@ -312,24 +488,82 @@ private:
 	--------------------------------------------------------------------------*/
 	Justification* justification;
 
+	/*--------------------------------------------------------------------------
+		The coalition clause with an empty disjunction that this clause was
+		rewritten from, while this clause has a provisional identifier. It is
+		archived once this clause is given an identifier. Null otherwise.
+	--------------------------------------------------------------------------*/
+	Clause* rewritten_clause = nullptr;
+
+	/*--------------------------------------------------------------------------
+		The clause index against which this resolvent was checked for forward
+		subsumption before it was built, so that it need not be checked again.
+		Null if it was not checked.
+	--------------------------------------------------------------------------*/
+	const ClauseIndex* subsumption_checked_index = nullptr;
+
 	/*--------------------------------------------------------------------------
 		Used during unit propagation.
 	--------------------------------------------------------------------------*/
 	bool active;
 
+	/*--------------------------------------------------------------------------
+		Set once the clause has been selected and resolved. Only the clause
+		index storing the clause changes this tag.
+	--------------------------------------------------------------------------*/
+	bool saturated;
+
+	/*--------------------------------------------------------------------------
+		Set when the clause is lazily removed from a clause index, every scan
+		of the index or of a selection queue skips the clause from then on.
+		Only the clause index storing the clause changes this tag.
+	--------------------------------------------------------------------------*/
+	bool dead;
+
+	/*--------------------------------------------------------------------------
+		Set if the clause is in the set of support, with the set of support
+		strategy two clauses that are not supported are never resolved.
+	--------------------------------------------------------------------------*/
+	bool supported;
+
 	/*--------------------------------------------------------------------------
 		A pointer to the index node at which the clause is stored. St to null if
 		the clause is not stored in an index.
 	--------------------------------------------------------------------------*/
 	IndexNode* index_node;
 
+	/*--------------------------------------------------------------------------
+		For a coalition clause stored in an index, the index nodes at which the
+		clause is stored for each literal in its conjunction, in the order of
+		the conjunction. Set to null if the clause is not stored in an index.
+	--------------------------------------------------------------------------*/
+	IndexNode** negated_left_nodes;
+
+	/*--------------------------------------------------------------------------
+		The literals chosen by the literal selection function when the clause
+		was stored in an index, in the order of the disjunction. Set to null if
+		no literal is selected or if only the maximal literal is selected.
+	--------------------------------------------------------------------------*/
+	std::vector<Literal*>* selected_literals;
+
+	/*--------------------------------------------------------------------------
+		For a clause with selected literals stored in an index, the index nodes
+		at which the clause is stored for each selected literal, in the order
+		of the selected literals. The maximal literal is not stored again so
+		its entry is null. Set to null if the clause is not stored in an index.
+	--------------------------------------------------------------------------*/
+	IndexNode** selected_nodes;
+
 	/*==========================================================================
 		Private Constructors
 	==========================================================================*/
 	/*--------------------------------------------------------------------------
 		Used to create a new clause without rewriting.
 	--------------------------------------------------------------------------*/
-	Clause() {}
+	Clause(): positive_positions(0), negative_positions(0), negative_move(0),
+		coalition_signature(0), agent_signature(0), saturated(false),
+		dead(false), supported(true), negated_left_nodes(nullptr),
+		selected_literals(nullptr), selected_nodes(nullptr) {}
 
 	/*==========================================================================
 		Private Functions
@@ -353,6 +587,49 @@ private:
 	--------------------------------------------------------------------------*/
 	bool isAgentSubsetOf(Clause*);
 
+	/*--------------------------------------------------------------------------
+		selectLiterals
+
+		Applies the given literal selection function to the disjunction of this
+		clause and stores the result as the selected literals. Only negative
+		literals are selected, and only those of universal and initial clauses
+		unless every negative literal is selected.
+	--------------------------------------------------------------------------*/
+	void selectLiterals(const int);
+
+	/*--------------------------------------------------------------------------
+		addMoveToShape
+
+		Records the move at the given position of the coalition vector in the
+		shape of the vector.
+	--------------------------------------------------------------------------*/
+	inline void addMoveToShape(const unsigned int position, const int move)
+	{
+		if(move != 0)
+		{
+			// hash the position and move to a single bit of the signature
+			uint64_t hash = ((static_cast<uint64_t>(position) + 1) *
+				0x9E3779B97F4A7C15ULL) ^ (static_cast<uint64_t>(move) *
+					0xC2B2AE3D27D4EB4FULL);
+			coalition_signature |= static_cast<uint64_t>(1) << (hash >> 58);
+		}
+		if(move < 0)
+		{
+			negative_move = move;
+		}
+		if(position < 64)
+		{
+			if(move > 0)
+			{
+				positive_positions |= static_cast<uint64_t>(1) << position;
+			}
+			else if(move < 0)
+			{
+				negative_positions |= static_cast<uint64_t>(1) << position;
+			}
+		}
+	}
+
 	/*==========================================================================
 		Friend Classes
 	==========================================================================*/
@@ -8,7 +8,7 @@
 	File			: clause_index.h
 	Author			: Paul Gainer
 	Created			: 29/06/2014
-	Last modified	: 16/09/2014
+	Last modified	: 19/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -34,10 +34,16 @@
 #ifndef CLAUSE_INDEX_H_
 #define CLAUSE_INDEX_H_
 
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
 #include "enums/clause_type.h"
+#include "enums/inference_rule.h"
 
 class Clause;
 class IndexNode;
+class LiteralList;
 
 /*==============================================================================
 	ClauseIndex
@@ -65,6 +71,7 @@ public:
 		Accessors/Mutators
 	==========================================================================*/
 	inline int size() const {return num_clauses;}
+	inline int getNumPassiveClauses() const {return num_passive_clauses;}
 
 	/*==========================================================================
 		Public Functions
@@ -85,10 +92,46 @@ public:
 	--------------------------------------------------------------------------*/
 	void removeFromIndex(Clause*);
 
+	/*--------------------------------------------------------------------------
+		lazyRemoveFromIndex
+
+		Marks the clause as dead and removes it from the clause counts of the
+		index, leaving it linked into the lists of clauses until the dead
+		clauses make up more than DEAD_CLAUSE_COMPACTION_PERCENT percent of the
+		index, when all of the dead clauses are unlinked. The removal must not
+		happen while the lists of the index are being traversed.
+	--------------------------------------------------------------------------*/
+	void lazyRemoveFromIndex(Clause*);
+
+	/*--------------------------------------------------------------------------
+		markSaturated
+
+		Tags the given passive clause stored in the index as saturated, so that
+		it is no longer returned by getNextSmallestClause and can be resolved
+		with.
+	--------------------------------------------------------------------------*/
+	void markSaturated(Clause*);
+
+	/*--------------------------------------------------------------------------
+		markUnsaturated
+
+		Tags the given saturated clause stored in the index as passive again,
+		so that it can be selected once more.
+	--------------------------------------------------------------------------*/
+	void markUnsaturated(Clause*);
+
+	/*--------------------------------------------------------------------------
+		getUnsupportedClauses
+
+		Returns all of the saturated clauses stored in the index that are not
+		in the set of support, in order of identifier.
+	--------------------------------------------------------------------------*/
+	std::list<Clause*>* getUnsupportedClauses();
+
 	/*--------------------------------------------------------------------------
 		displayIndex
 
-		Displays all of the clauses stored in the index.
+		Displays all of the saturated clauses stored in the index.
 	--------------------------------------------------------------------------*/
 	void displayIndex();
 
@@ -120,6 +163,56 @@ public:
 	std::list<IndexNode*>* filterByMinLiteralAndLength(int, int,
 			std::list<ClauseType>*);
 
+	/*--------------------------------------------------------------------------
+		filterByNegatedLeft
+
+		Returns all the universal clauses in the index that could subsume the
+		given coalition clause through its conjunction, that is those having as
+		maximal literal the complement of a literal in the conjunction and
+		having a size no more than the size of the conjunction. Clauses having
+		a maximal literal with a rank no greater than the given rank and a size
+		no more than the given length are excluded, as these have already been
+		retrieved by filterByMaxLiteralAndLength.
+	--------------------------------------------------------------------------*/
+	std::list<IndexNode*>* filterByNegatedLeft(Clause*, int, int);
+
+	/*--------------------------------------------------------------------------
+		filterByNegatedLeftLiteral
+
+		Returns all the coalition clauses in the index having a conjunction that
+		contains the complement of the literal with the given rank.
+	--------------------------------------------------------------------------*/
+	std::list<IndexNode*>* filterByNegatedLeftLiteral(int);
+
+	/*--------------------------------------------------------------------------
+		filterByResolutionLiteral
+
+		Returns all the clauses in the index of the given types having as
+		maximal literal the literal with the given rank, along with all the
+		clauses of the given types having the literal with the given rank
+		selected. Clauses with this maximal literal that select other literals
+		are not resolved upon it and must be skipped.
+	--------------------------------------------------------------------------*/
+	std::list<IndexNode*>* filterByResolutionLiteral(int,
+		std::list<ClauseType>*);
+
+	/*--------------------------------------------------------------------------
+		findCachedSubsumer
+
+		Returns a recently successful subsumer stored in the index that
+		subsumes the given clause, moving it to the front of the subsumer cache,
+		or nullptr if no cached clause subsumes the given clause.
+	--------------------------------------------------------------------------*/
+	Clause* findCachedSubsumer(Clause*);
+
+	/*--------------------------------------------------------------------------
+		cacheSubsumer
+
+		Stores the given indexed clause at the front of the subsumer cache,
+		evicting the least recently successful subsumer if the cache is full.
+	--------------------------------------------------------------------------*/
+	void cacheSubsumer(Clause*);
+
 	/*--------------------------------------------------------------------------
 		getNumClauses
 
@@ -130,7 +223,7 @@ public:
 	/*--------------------------------------------------------------------------
 		getNextSmallestClause
 
-		Returns the smallest clause currently stored in the index.
+		Returns the smallest passive clause currently stored in the index.
 	--------------------------------------------------------------------------*/
 	Clause* getNextSmallestClause();
 
@@ -138,8 +231,11 @@ public:
 		resolve
 
 		Returns the list of all simplified non-tautological resolvents derivable
-		between the given clause and compatible clauses in the index, using
-		IRES1/GRES1/CRES1/CRES2/CRES3/CRES4/CRES5.
+		between the given clause and compatible saturated clauses in the index,
+		using IRES1/GRES1/CRES1/CRES2/CRES3/CRES4/CRES5, or HRES in place of
+		IRES1/GRES1 if hyperresolution is enabled. A clause with selected
+		literals is resolved upon each of them. The resolvents are given
+		provisional identifiers.
 	--------------------------------------------------------------------------*/
 	std::list<Clause*>* resolve(Clause*);
 
@@ -161,6 +257,24 @@ private:
 	---------------------------------------------------------------------------*/
 	struct InternalNodeTerminal;
 
+	/*--------------------------------------------------------------------------
+		ResolventKeyHash
+
+		Hashes the structural key of a resolvent.
+	--------------------------------------------------------------------------*/
+	struct ResolventKeyHash
+	{
+		std::size_t operator()(const std::vector<int>& key) const
+		{
+			uint64_t hash = 0xCBF29CE484222325;
+			for(int value : key)
+			{
+				hash = (hash ^ static_cast<uint32_t>(value)) * 0x100000001B3;
+			}
+			return hash ^ (hash >> 32);
+		}
+	};
+
 	/*==========================================================================
 		Private Member Variables
 	==========================================================================*/
@@ -174,6 +288,11 @@ private:
 	--------------------------------------------------------------------------*/
 	int num_clauses = 0;
 
+	/*--------------------------------------------------------------------------
+		The number of passive clauses stored in the index.
+	--------------------------------------------------------------------------*/
+	int num_passive_clauses = 0;
+
 	/*--------------------------------------------------------------------------
 		The maximum size of each tree level.
 	--------------------------------------------------------------------------*/
@@ -189,6 +308,73 @@ private:
 	--------------------------------------------------------------------------*/
 	InternalNode** root;
 
+	/*--------------------------------------------------------------------------
+		The coalition clauses stored in the index, where the list at position r
+		contains every clause with the complement of the literal with rank r in
+		its conjunction.
+	--------------------------------------------------------------------------*/
+	IndexNode** negated_left_leaves;
+
+	/*--------------------------------------------------------------------------
+		The clauses stored in the index with selected literals, where the list
+		at position [t][r] contains every clause of type t having the literal
+		with rank r selected but not maximal.
+	--------------------------------------------------------------------------*/
+	IndexNode*** selected_leaves;
+
+	/*--------------------------------------------------------------------------
+		The clauses in the index that most recently forward subsumed a clause,
+		ordered from most to least recently successful.
+	--------------------------------------------------------------------------*/
+	Clause** subsumer_cache;
+
+	/*--------------------------------------------------------------------------
+		The number of clauses stored in the subsumer cache.
+	--------------------------------------------------------------------------*/
+	int subsumer_cache_count = 0;
+
+	/*--------------------------------------------------------------------------
+		The structural keys of the resolvents derived by the current call to
+		resolve.
+	--------------------------------------------------------------------------*/
+	std::unordered_set<std::vector<int>, ResolventKeyHash> batch_resolvents;
+
+	/*--------------------------------------------------------------------------
+		The hashes of recently derived resolvents, where each hash is stored at
+		the position it selects, replacing any hash already stored there. The
+		table is only allocated by the first call to resolve, and grows with
+		the number of resolvents recorded.
+	--------------------------------------------------------------------------*/
+	std::vector<uint64_t> recent_fingerprints;
+
+	/*--------------------------------------------------------------------------
+		The number of resolvents recorded since the table of recent resolvents
+		last grew.
+	--------------------------------------------------------------------------*/
+	unsigned int recent_count = 0;
+
+	/*--------------------------------------------------------------------------
+		The structural keys of the resolvents in recent_fingerprints, only
+		compared when the hashes are equal.
+	--------------------------------------------------------------------------*/
+	std::vector<std::vector<int>> recent_keys;
+
+	/*--------------------------------------------------------------------------
+		The structural key of the resolvent being checked by
+		isDuplicateResolvent.
+	--------------------------------------------------------------------------*/
+	std::vector<int> resolvent_key;
+
+	/*--------------------------------------------------------------------------
+		The disjunction of the resolvent being derived, ordered by rank.
+	--------------------------------------------------------------------------*/
+	std::vector<Literal*> resolvent_literals;
+
+	/*--------------------------------------------------------------------------
+		The dead clauses that are still linked into the index.
+	--------------------------------------------------------------------------*/
+	std::vector<Clause*> dead_clauses;
+
 	/*==========================================================================
 		Private Functions
 	==========================================================================*/
@@ -210,6 +396,72 @@ private:
 	--------------------------------------------------------------------------*/
 	void deleteNextLevel(int, InternalNode**);
 
+	/*--------------------------------------------------------------------------
+		resolveUpon
+
+		Adds to the given list the resolvents derivable between the given
+		clause, resolved upon the given literal, and compatible saturated
+		clauses in the index. Returns true if a contradiction was derived.
+	--------------------------------------------------------------------------*/
+	bool resolveUpon(Clause*, Literal*, std::list<Clause*>*);
+
+	/*--------------------------------------------------------------------------
+		hyperresolve
+
+		Adds to the given list the hyperresolvents derivable using the given
+		universal or initial clause, either as the nucleus or as one of the
+		satellites, and saturated universal and initial clauses in the index.
+		Returns true if a contradiction was derived.
+	--------------------------------------------------------------------------*/
+	bool hyperresolve(Clause*, std::list<Clause*>*);
+
+	/*--------------------------------------------------------------------------
+		resolveNucleus
+
+		Adds to the given list every hyperresolvent of the given nucleus, that
+		is the resolvent of the nucleus with one positive saturated satellite
+		for each of its negative selected literals. If a satellite is given
+		then it is the only satellite used for the complement of its maximal
+		literal. Returns true if a contradiction was derived.
+	--------------------------------------------------------------------------*/
+	bool resolveNucleus(Clause*, Clause*, std::list<Clause*>*);
+
+	/*--------------------------------------------------------------------------
+		extendHyperresolvent
+
+		Extends the given partial hyperresolvent of the given nucleus with each
+		candidate satellite for the literal at the given position, and then
+		with the satellites for the following literals, adding to the given
+		list the complete hyperresolvents derived. A partial hyperresolvent is
+		dropped as soon as it is a tautology or, when forward subsumption is
+		enabled, is subsumed by a clause in the index, as then so is every
+		hyperresolvent extending it. Returns true if a contradiction was
+		derived.
+	--------------------------------------------------------------------------*/
+	bool extendHyperresolvent(Clause*, const std::vector<std::vector<Clause*>>&,
+		unsigned int, LiteralList*, std::vector<int>&, bool, bool,
+		std::list<Clause*>*);
+
+	/*--------------------------------------------------------------------------
+		isSubsumedDisjunction
+
+		Returns true if a universal or initial clause in the index subsumes the
+		given disjunction, ordered by rank and considered as a clause of the
+		given type.
+	--------------------------------------------------------------------------*/
+	bool isSubsumedDisjunction(ClauseType, const std::vector<Literal*>&);
+
+	/*--------------------------------------------------------------------------
+		mayResolve
+
+		Returns true if the given clause may be resolved with the given clause
+		stored in the index upon the given literal of the stored clause, that
+		is if the stored clause is saturated and not dead, the stored clause
+		either selects the literal or selects nothing, and at least one of the
+		clauses is in the set of support.
+	--------------------------------------------------------------------------*/
+	bool mayResolve(Clause*, Clause*, Literal*);
+
 	/*--------------------------------------------------------------------------
 		getClauseList
 
@@ -235,9 +487,89 @@ private:
 	--------------------------------------------------------------------------*/
 	void displayNextFeature(InternalNode**, int, std::list<Clause*>*);
 
+	/*--------------------------------------------------------------------------
+		updateCounts
+
+		Adds the given changes to the clause and passive clause counts along the
+		path of the clause through the index tree. Returns the leaves at the end
+		of the path, setting the last parameter to the position of the clause.
+	--------------------------------------------------------------------------*/
+	IndexNode** updateCounts(Clause*, int, int, int*);
+
+	/*--------------------------------------------------------------------------
+		compactIndex
+
+		Unlinks all of the dead clauses from the index.
+	--------------------------------------------------------------------------*/
+	void compactIndex();
+
+	/*--------------------------------------------------------------------------
+		uncacheSubsumer
+
+		Removes the clause from the subsumer cache if it is cached.
+	--------------------------------------------------------------------------*/
+	void uncacheSubsumer(Clause*);
+
+	/*--------------------------------------------------------------------------
+		isDuplicateResolvent
+
+		Builds the structural key of the resolvent having the given type,
+		conjunction, agents, disjunction and coalition vector. Returns true if
+		the same resolvent was already derived in the current call to resolve
+		or is in the table of recent resolvents, otherwise records the key and
+		returns false.
+	--------------------------------------------------------------------------*/
+	bool isDuplicateResolvent(ClauseType, LiteralList*, std::list<int>*,
+		const std::vector<Literal*>&, std::vector<int>*);
+
+	/*--------------------------------------------------------------------------
+		addResolvent
+
+		Adds to the given list the resolvent of the given clauses upon the
+		given literal by the given rule, having the given type, conjunction,
+		agents and coalition vector and the disjunction in resolvent_literals,
+		unless it is a duplicate. The conjunction, agents and coalition vector
+		are null for universal and initial resolvents, and are copied if the
+		flag is set or otherwise deleted along with a duplicate. A universal or
+		initial resolvent that is forward subsumed by a clause in the index is
+		discarded before a clause is built for it. Returns true if a
+		contradiction was derived.
+	--------------------------------------------------------------------------*/
+	bool addResolvent(ClauseType, LiteralList*, std::list<int>*,
+		std::vector<int>*, const bool, Clause*, Clause*, Literal*,
+		InferenceRule, std::list<Clause*>*);
+
+	/*--------------------------------------------------------------------------
+		isForwardSubsumedResolvent
+
+		Returns true if forward subsumption is enabled and the universal or
+		initial resolvent of the given type having the disjunction in
+		resolvent_literals is subsumed by a clause in the index, counting it
+		as forward subsumed. Resolvents are not checked here when the literal
+		activity heuristic is used. The flag is set if the resolvent was
+		checked, so that it is not checked against the index again.
+	--------------------------------------------------------------------------*/
+	bool isForwardSubsumedResolvent(ClauseType, bool*);
+
 	/*==========================================================================
 			Private Static Functions
 	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		addToList
+
+		Stores the clause in a new node at the start of the list at the given
+		position and returns the new node.
+	--------------------------------------------------------------------------*/
+	static IndexNode* addToList(IndexNode**, int, Clause*);
+
+	/*--------------------------------------------------------------------------
+		removeFromList
+
+		Unlinks the given node from the list at the given position and deletes
+		it.
+	--------------------------------------------------------------------------*/
+	static void removeFromList(IndexNode**, int, IndexNode*);
+
 	/*------------------------------------------------------------------------------
 		displayTautology
 	------------------------------------------------------------------------------*/
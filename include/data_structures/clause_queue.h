@@ -0,0 +1,107 @@
+/*==============================================================================
+	ClauseQueue
+
+	A first-in first-out queue of clauses that is kept in order of increasing
+	clause identifier. Clauses removed from their index are left in the queue
+	as dead clauses until they are reached or purged.
+
+	File			: clause_queue.h
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 18/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#ifndef CLAUSE_QUEUE_H_
+#define CLAUSE_QUEUE_H_
+
+#include <deque>
+#include <vector>
+
+class Clause;
+
+/*==============================================================================
+	ClauseQueue
+==============================================================================*/
+class ClauseQueue
+{
+public:
+	/*==========================================================================
+		Public Functions
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		push
+
+		Adds the given clause to the queue. Clauses pushed since the queue was
+		last read are sorted by identifier and merged into the queue together.
+	--------------------------------------------------------------------------*/
+	inline void push(Clause* clause) {pending.push_back(clause);}
+
+	/*--------------------------------------------------------------------------
+		pop
+
+		Removes and returns the clause with the smallest identifier, which
+		may be dead. The queue must not be empty.
+	--------------------------------------------------------------------------*/
+	Clause* pop();
+
+	/*--------------------------------------------------------------------------
+		empty/size
+	--------------------------------------------------------------------------*/
+	inline bool empty() const {return queue.empty() && pending.empty();}
+	inline unsigned int size() const {return queue.size() + pending.size();}
+
+	/*--------------------------------------------------------------------------
+		removeDead
+
+		Removes all of the dead clauses from the queue.
+	--------------------------------------------------------------------------*/
+	void removeDead();
+
+private:
+	/*==========================================================================
+		Private Functions
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		mergePending
+
+		Sorts the pending clauses by identifier and merges them into the
+		queue. Identifiers are mostly assigned in the order clauses are queued,
+		so usually the pending clauses are simply appended.
+	--------------------------------------------------------------------------*/
+	void mergePending();
+
+	/*==========================================================================
+		Private Member Variables
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		The queued clauses in order of increasing identifier.
+	--------------------------------------------------------------------------*/
+	std::deque<Clause*> queue;
+
+	/*--------------------------------------------------------------------------
+		The clauses pushed since the queue was last read.
+	--------------------------------------------------------------------------*/
+	std::vector<Clause*> pending;
+};
+
+#endif
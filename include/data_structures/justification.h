@@ -10,7 +10,7 @@
 	File			: justification.h
 	Author			: Paul Gainer
 	Created			: 16/06/2014
-	Last modified	: 16/09/2014
+	Last modified	: 18/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -36,6 +36,8 @@
 #ifndef JUSTIFICATION_H_
 #define JUSTIFICATION_H_
 
+#include <vector>
+
 #include "data_structures/clause.h"
 #include "data_structures/literal.h"
 
@@ -61,7 +63,14 @@ struct Justification
 	const int input_clause_2;
 
 	/*--------------------------------------------------------------------------
-		The literal resolved to derive this clause.
+		The satellites with which the first clause was hyperresolved to derive
+		this clause. Null if this clause was not derived by hyperresolution.
+	--------------------------------------------------------------------------*/
+	const std::vector<int>* satellites;
+
+	/*--------------------------------------------------------------------------
+		The literal resolved to derive this clause. Null if this clause was
+		derived by hyperresolution upon several literals.
 	--------------------------------------------------------------------------*/
 	const Literal* resolved_literal;
 
@@ -71,12 +80,21 @@ struct Justification
 	InferenceRule inference_rule;
 
 	/*==========================================================================
-		Struct Constructor
+		Struct Constructors/Deconstructor
 	==========================================================================*/
 	Justification(const int input_clause_1, const int input_clause_2,
 		const Literal* resolved_literal, InferenceRule inference_rule):
 			input_clause_1(input_clause_1), input_clause_2(input_clause_2),
-			resolved_literal(resolved_literal), inference_rule(inference_rule){}
+			satellites(nullptr), resolved_literal(resolved_literal),
+			inference_rule(inference_rule){}
+
+	Justification(const int nucleus, const std::vector<int>* satellites,
+		InferenceRule inference_rule):
+			input_clause_1(nucleus), input_clause_2(-1),
+			satellites(satellites), resolved_literal(nullptr),
+			inference_rule(inference_rule){}
+
+	~Justification() {delete satellites;}
 };
 
 #endif
@@ -9,7 +9,7 @@
 	File			: literal.h
 	Author			: Paul Gainer
 	Created			: 16/06/2014
-	Last modified	: 16/09/2014
+	Last modified	: 18/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -78,6 +78,12 @@ struct Literal
 	--------------------------------------------------------------------------*/
 	int rank;
 
+	/*--------------------------------------------------------------------------
+		The number of occurrences of this literal in the parsed clauses, used
+		by the literal selection functions.
+	--------------------------------------------------------------------------*/
+	int occurrences;
+
 	/*==========================================================================
 		Struct Constructor/Deconstructor
 	==========================================================================*/
@@ -7,7 +7,7 @@
 	File			: literal_list.h
 	Author			: Paul Gainer
 	Created			: 23/06/2014
-	Last modified	: 16/09/2014
+	Last modified	: 19/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -34,9 +34,21 @@
 #define LITERAL_LIST_H_
 
 #include <list>
+#include <vector>
 
 #include "data_structures/literal.h"
 
+/*==============================================================================
+	LiteralMask
+
+	A bitmask over literal ranks, where the literal with rank r is represented
+	by bit r - 1. With more literals than bits, rank r is represented by bit
+	(r - 1) modulo the number of bits, so that several literals share each bit.
+	Complementary literals always occupy a pair of adjacent bits
+	(2k - 2, 2k - 1).
+==============================================================================*/
+typedef unsigned __int128 LiteralMask;
+
 /*==============================================================================
 	LiteralList
 ==============================================================================*/
@@ -51,7 +63,7 @@ public:
 
 		Creates a new empty literal list.
 	--------------------------------------------------------------------------*/
-	LiteralList(): list(nullptr) {}
+	LiteralList(): list(nullptr), mask(0) {}
 
 	/*--------------------------------------------------------------------------
 		LiteralList
@@ -62,6 +74,23 @@ public:
 	{
 		list = other.list ==
 			nullptr ? nullptr : new std::list<Literal*>(*(other.list));
+		mask = other.mask;
+	}
+
+	/*--------------------------------------------------------------------------
+		LiteralList
+
+		Creates a new literal list holding the given literals, which must be
+		ordered by rank.
+	--------------------------------------------------------------------------*/
+	LiteralList(const std::vector<Literal*>& literals): mask(0)
+	{
+		list = literals.empty() ?
+			nullptr : new std::list<Literal*>(literals.begin(), literals.end());
+		if(use_literal_masks)
+		{
+			calculateMask();
+		}
 	}
 
 	/*--------------------------------------------------------------------------
@@ -72,11 +101,28 @@ public:
 		delete list;
 	}
 
+	/*==========================================================================
+		Public Static Member Variables
+	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		Set to true if each list maintains a bitmask of its literals.
+	--------------------------------------------------------------------------*/
+	static bool use_literal_masks;
+
+	/*--------------------------------------------------------------------------
+		Set to true if every literal rank fits into a LiteralMask, in which case
+		set operations are performed on the bitmasks instead of the lists.
+		Otherwise a bitmask only rules out subsets before the lists are
+		compared.
+	--------------------------------------------------------------------------*/
+	static bool exact_literal_masks;
+
 	/*==========================================================================
 		Accessors/Mutators
 	==========================================================================*/
 	inline std::list<Literal*>* getList() const {return list;}
 	inline int size() const {return (list == nullptr ? 0 : list->size());}
+	inline LiteralMask getMask() const {return mask;}
 
 	/*==========================================================================
 		Public Functions
@@ -103,6 +149,13 @@ public:
 	--------------------------------------------------------------------------*/
 	LiteralList* removeMaximalLiteral();
 
+	/*--------------------------------------------------------------------------
+		removeLiteral
+
+		Returns a copy of the list with the given literal removed.
+	--------------------------------------------------------------------------*/
+	LiteralList* removeLiteral(Literal*);
+
 	/*--------------------------------------------------------------------------
 		addLiteral
 
@@ -111,6 +164,14 @@ public:
 	--------------------------------------------------------------------------*/
 	void addLiteral(Literal*);
 
+	/*--------------------------------------------------------------------------
+		sortByRank
+
+		Restores the order of the list after the ranks of its literals have
+		been changed. The bitmask is not updated.
+	--------------------------------------------------------------------------*/
+	void sortByRank();
+
 	/*--------------------------------------------------------------------------
 		isSubsetOf
 
@@ -118,6 +179,14 @@ public:
 	--------------------------------------------------------------------------*/
 	bool isSubsetOf(LiteralList*);
 
+	/*--------------------------------------------------------------------------
+		isSubsetOf
+
+		Returns true if this list is a subset of the given literals, ordered by
+		rank, whose bitmask is also given.
+	--------------------------------------------------------------------------*/
+	bool isSubsetOf(const std::vector<Literal*>&, const LiteralMask);
+
 	/*--------------------------------------------------------------------------
 		isSubsetOfNegationOf
 
@@ -125,9 +194,60 @@ public:
 	--------------------------------------------------------------------------*/
 	bool isSubsetOfNegationOf(LiteralList*);
 
+	/*--------------------------------------------------------------------------
+		subsumptionResolves
+
+		If every literal in this list but one is in the given list, and the
+		complement of the remaining literal is in the given list, returns that
+		complement. Otherwise returns null.
+	--------------------------------------------------------------------------*/
+	Literal* subsumptionResolves(LiteralList*);
+
+	/*--------------------------------------------------------------------------
+		calculateMask
+
+		Rebuilds the bitmask of this list from its literals. Needed whenever
+		literal ranks change or literals are erased from the underlying list
+		directly.
+	--------------------------------------------------------------------------*/
+	void calculateMask();
+
 	/*==========================================================================
 		Public Static Functions
 	==========================================================================*/
+	/*--------------------------------------------------------------------------
+		literalBit
+
+		Returns the bitmask containing only the given literal.
+	--------------------------------------------------------------------------*/
+	inline static LiteralMask literalBit(const Literal* literal)
+	{
+		return static_cast<LiteralMask>(1) <<
+			(static_cast<unsigned int>(literal->rank - 1) %
+			(sizeof(LiteralMask) * 8));
+	}
+
+	/*--------------------------------------------------------------------------
+		literalsMask
+
+		Returns the bitmask containing the given literals.
+	--------------------------------------------------------------------------*/
+	static LiteralMask literalsMask(const std::vector<Literal*>&);
+
+	/*--------------------------------------------------------------------------
+		complementMask
+
+		Returns the bitmask containing the complement of each literal in the
+		given bitmask, by swapping each pair of adjacent bits.
+	--------------------------------------------------------------------------*/
+	inline static LiteralMask complementMask(const LiteralMask m)
+	{
+		const LiteralMask EVEN_BITS =
+			(static_cast<LiteralMask>(0x5555555555555555ULL) << 64) |
+				0x5555555555555555ULL;
+		return ((m & EVEN_BITS) << 1) | ((m >> 1) & EVEN_BITS);
+	}
+
 	/*--------------------------------------------------------------------------
 		unionLiterals
 
@@ -137,6 +257,19 @@ public:
 	static std::pair<LiteralList*, const bool>* unionLiterals(
 			LiteralList*, LiteralList*);
 
+	/*--------------------------------------------------------------------------
+		resolvedUnion
+
+		Writes the union of the two lists, without the given literal of each,
+		to the given vector ordered by rank. Returns true if the union is a
+		tautology. The result is the same as unionLiterals applied to the
+		lists with the literals removed, but no list is built. With exact
+		bitmasks a tautology is found before the lists are merged, leaving the
+		vector empty.
+	--------------------------------------------------------------------------*/
+	static bool resolvedUnion(LiteralList*, Literal*, LiteralList*, Literal*,
+		std::vector<Literal*>&);
+
 private:
 	/*==========================================================================
 		Private Member Variables
@@ -146,6 +279,12 @@ private:
 	--------------------------------------------------------------------------*/
 	std::list<Literal*>* list;
 
+	/*--------------------------------------------------------------------------
+		The bitmask of the literals in the list, only maintained if
+		use_literal_masks is set.
+	--------------------------------------------------------------------------*/
+	LiteralMask mask;
+
 	friend class Clause;
 };
 
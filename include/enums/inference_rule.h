@@ -6,7 +6,7 @@
 	File			: inference_rule.h
 	Author			: Paul Gainer
 	Created			: 16/06/2014
-	Last modified	: 16/09/2014
+	Last modified	: 18/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -34,7 +34,8 @@
 
 enum InferenceRule
 {
-	IRES1 = 0, GRES1, CRES1, CRES2, CRES3, CRES4, CRES5, RW1, RW2
+	IRES1 = 0, GRES1, CRES1, CRES2, CRES3, CRES4, CRES5, RW1, RW2, SRES, HRES,
+	SPLIT, SYM
 };
 
 #endif
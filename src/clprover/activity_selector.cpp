@@ -0,0 +1,216 @@
+/*==============================================================================
+	File			: activity_selector.cpp
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 19/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#include <algorithm>
+#include <iostream>
+
+#include "clprover/activity_selector.h"
+#include "clprover/define.h"
+
+#include "data_structures/clause.h"
+#include "data_structures/literal.h"
+#include "data_structures/literal_list.h"
+
+/*==============================================================================
+	Constructors/Deconstructor
+==============================================================================*/
+ActivitySelector::ActivitySelector(int max_rank, int activity_ratio):
+	activities(max_rank + 1, 0.0), activity_ratio(activity_ratio)
+{
+}
+
+/*==============================================================================
+	Public Functions
+==============================================================================*/
+void ActivitySelector::bumpLiteral(const Literal* literal)
+{
+	activities[literal->rank] += activity_increment;
+	activities[literal->complementary_literal->rank] += activity_increment;
+	max_activity = std::max(max_activity, activities[literal->rank]);
+	max_activity = std::max(max_activity,
+		activities[literal->complementary_literal->rank]);
+	bumps++;
+}
+
+void ActivitySelector::bumpClause(const Clause* clause)
+{
+	for(LiteralList* literal_list : {clause->getLeft(), clause->getRight()})
+	{
+		if(literal_list->getList() != nullptr)
+		{
+			std::for_each(literal_list->getList()->begin(),
+				literal_list->getList()->end(),
+				[&](Literal* l)
+				{
+					activities[l->rank] += activity_increment;
+					max_activity = std::max(max_activity, activities[l->rank]);
+				});
+		}
+	}
+	bumps++;
+}
+
+void ActivitySelector::decayActivities()
+{
+	activity_increment /= ACTIVITY_DECAY;
+	if(activity_increment > ACTIVITY_RESCALE_LIMIT)
+	{
+		// scale everything down, which preserves the order of the activities
+		std::for_each(activities.begin(), activities.end(),
+			[](double& activity)
+			{
+				activity /= ACTIVITY_RESCALE_LIMIT;
+			});
+		activity_increment /= ACTIVITY_RESCALE_LIMIT;
+		max_activity /= ACTIVITY_RESCALE_LIMIT;
+	}
+}
+
+void ActivitySelector::addClause(Clause* clause)
+{
+	age_queue.push(clause);
+	queue.push_back({score(clause), clause->getIdentifier(), clause});
+	std::push_heap(queue.begin(), queue.end());
+}
+
+Clause* ActivitySelector::getNext()
+{
+	if(++selections >= ACTIVITY_RESCORE_INTERVAL)
+	{
+		rescore();
+		selections = 0;
+	}
+	Clause* next = nullptr;
+	if(activity_selections < activity_ratio)
+	{
+		next = popActivity();
+		if(next != nullptr)
+		{
+			activity_selections++;
+			selected_by_activity++;
+			return next;
+		}
+	}
+	// it is the turn of the age queue, or the activity queue is exhausted
+	next = popAge();
+	if(next != nullptr)
+	{
+		activity_selections = 0;
+		selected_by_age++;
+	}
+	return next;
+}
+
+void ActivitySelector::displayStatistics() const
+{
+	std::cout << "Literal activity bumps: " << bumps << std::endl;
+	std::cout << "Activity queue rescores: " << rescores << std::endl;
+	std::cout << "Clauses selected by activity: " << selected_by_activity <<
+		std::endl;
+	std::cout << "Clauses selected by age: " << selected_by_age << std::endl;
+	std::cout << "Stale selection queue entries skipped: " <<
+		entries_skipped << std::endl;
+}
+
+/*==============================================================================
+	Private Functions
+==============================================================================*/
+double ActivitySelector::score(const Clause* clause) const
+{
+	if(clause->size() == 0)
+	{
+		return 0.0;
+	}
+	double total = 0.0;
+	for(LiteralList* literal_list : {clause->getLeft(), clause->getRight()})
+	{
+		if(literal_list->getList() != nullptr)
+		{
+			std::for_each(literal_list->getList()->begin(),
+				literal_list->getList()->end(),
+				[&](Literal* l)
+				{
+					total += activities[l->rank];
+				});
+		}
+	}
+	// the mean activity relative to the most active literal is below one, so
+	// it only orders clauses of the same size
+	return (max_activity == 0.0 ? 0.0 :
+		total / clause->size() / max_activity) - clause->size();
+}
+
+void ActivitySelector::rescore()
+{
+	// drop the stale entries and score the waiting clauses again
+	std::vector<ScoredClause> rescored_queue;
+	rescored_queue.reserve(queue.size());
+	std::for_each(queue.begin(), queue.end(),
+		[&](ScoredClause& entry)
+		{
+			if(entry.clause->isSaturated() || entry.clause->isDead())
+			{
+				entries_skipped++;
+				return;
+			}
+			entry.score = score(entry.clause);
+			rescored_queue.push_back(entry);
+		});
+	std::make_heap(rescored_queue.begin(), rescored_queue.end());
+	queue.swap(rescored_queue);
+	rescores++;
+}
+
+Clause* ActivitySelector::popAge()
+{
+	while(!age_queue.empty())
+	{
+		Clause* clause = age_queue.pop();
+		if(!clause->isSaturated() && !clause->isDead())
+		{
+			return clause;
+		}
+		entries_skipped++;
+	}
+	return nullptr;
+}
+
+Clause* ActivitySelector::popActivity()
+{
+	while(!queue.empty())
+	{
+		std::pop_heap(queue.begin(), queue.end());
+		Clause* clause = queue.back().clause;
+		queue.pop_back();
+		if(!clause->isSaturated() && !clause->isDead())
+		{
+			return clause;
+		}
+		entries_skipped++;
+	}
+	return nullptr;
+}
@@ -2,7 +2,7 @@
 	File			: clause_list.cpp
 	Author			: Paul Gainer
 	Created			: 05/07/2014
-	Last modified	: 17/04/2015
+	Last modified	: 18/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -26,10 +26,14 @@
 \==============================================================================/
 <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 #include <algorithm>
+#include <climits>
 #include <functional>
 #include <iostream>
-#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+#include "clprover/activity_selector.h"
 #include "clprover/clause_list.h"
 #include "clprover/define.h"
 #include "clprover/global.h"
@@ -40,10 +44,17 @@
 
 void clause_list::sortClauseList(std::list<Clause*>* clause_list)
 {
-	clause_list->sort([](Clause* this_clause, Clause* that_clause)
-	{
-		return *this_clause < *that_clause;
-	});
+	std::vector<Clause*> clauses(clause_list->begin(), clause_list->end());
+	std::vector<Clause*> sorted(clauses.size());
+	// least significant key first
+	sortByKey(clauses, sorted, [](Clause* c)
+		{
+			return c->getAgents() == nullptr ? 0 : c->getAgents()->size();
+		});
+	sortByKey(clauses, sorted, [](Clause* c) {return c->getLeft()->size();});
+	sortByKey(clauses, sorted, [](Clause* c) {return c->getRight()->size();});
+	sortByKey(clauses, sorted, [](Clause* c) {return c->getClauseType();});
+	std::copy(clauses.begin(), clauses.end(), clause_list->begin());
 }
 
 void clause_list::backwardSubsumption(std::list<Clause*>* clause_list,
@@ -91,142 +102,354 @@ void clause_list::backwardSubsumption(std::list<Clause*>* clause_list,
 				break;
 			}
 
+			// checks a candidate clause, counting the check
+			auto is_subsumed =
+				[&](Clause* candidate_clause)
+				{
+					g_backward_subsumption_candidates++;
+					return this_clause->subsumes(candidate_clause);
+				};
+
+			// archives the given subsumed clause and marks it for removal
+			auto remove_subsumed =
+				[&](Clause* subsumed_clause)
+				{
+					if(g_verbosity >= V_MAXIMAL)
+					{
+						std::cout << DIVIDER_2;
+						std::cout << "Backward subsumption:\n";
+						subsumed_clause->displayClause();
+						std::cout << "Subsumed by:\n";
+						this_clause->displayClause();
+						std::cout << DIVIDER_2;
+					}
+					g_backward_subsumed_count++;
+					if(g_activity_selector != nullptr)
+					{
+						g_activity_selector->bumpClause(this_clause);
+					}
+					g_archive->push_back(subsumed_clause);
+					removed_clauses.push_back(subsumed_clause);
+				};
+
 			std::for_each(filtered_clauses->begin(), filtered_clauses->end(),
 				[&](IndexNode* node)
 				{
-					//IndexNode* node = *filtered_it;
 					while(node != nullptr)
 					{
-						if(this_clause->subsumes(node->clause))
+						if(!node->clause->isDead() &&
+							is_subsumed(node->clause))
 						{
 							/* this indexed clause is subsumed so add it to the
 							   list of clauses to remove and add it to the
 							   archive */
-							if(g_verbosity >= V_MAXIMAL)
-							{
-								std::cout << DIVIDER_2;
-								std::cout << "Backward subsumption:\n";
-								node->clause->displayClause();
-								std::cout << "Subsumed by:\n";
-								this_clause->displayClause();
-								std::cout << DIVIDER_2;
-							}
-							g_backward_subsumed_count++;
-							g_archive->push_back(node->clause);
-							removed_clauses.push_back(node->clause);
+							remove_subsumed(node->clause);
 						}
 						node = node->next;
 					}
 				});
-			// finally remove all of the subsumed clauses from the index
+			if(this_clause->getClauseType() == ClauseType::UNIVERSAL)
+			{
+				/* a universal clause can also subsume a coalition clause
+				   through its conjunction, so retrieve the coalition clauses
+				   containing the complement of the maximal literal in their
+				   conjunction and skip those that have already been checked */
+				delete filtered_clauses;
+				filtered_clauses = clause_index.filterByNegatedLeftLiteral(rank);
+				std::for_each(filtered_clauses->begin(), filtered_clauses->end(),
+					[&](IndexNode* node)
+					{
+						while(node != nullptr)
+						{
+							Clause* c = node->clause;
+							if(!c->isDead() &&
+								(c->getRight()->getMaximalLiteral()->rank < rank ||
+								c->size() < this_clause->size()) &&
+								is_subsumed(c))
+							{
+								remove_subsumed(c);
+							}
+							node = node->next;
+						}
+					});
+			}
+			/* finally remove all of the subsumed clauses from the index, they
+			   are left in place as dead clauses to be skipped by later scans
+			   and selection */
 			std::for_each(removed_clauses.begin(), removed_clauses.end(),
 				[&](Clause* c)
 				{
-					clause_index.removeFromIndex(c);
+					clause_index.lazyRemoveFromIndex(c);
 				});
 			delete filtered_clauses;
 		});
 }
 
-void clause_list::backwardSubsumptionGetNext(std::list<Clause*>* clause_list,
-	ClauseIndex& clause_index,
-	std::set<Clause*, std::function<bool (Clause*, Clause*)>>* i_set,
-	std::set<Clause*, std::function<bool (Clause*, Clause*)>>* u_set,
-	std::set<Clause*, std::function<bool (Clause*, Clause*)>>* c_set)
+void clause_list::batchBackwardSubsumption(std::list<Clause*>* clause_list,
+	ClauseIndex& clause_index)
 {
+	std::vector<Clause*> subsumers;
+	std::unordered_set<Clause*> removed_clauses;
+	int min_rank = INT_MAX;
+	int min_size = INT_MAX;
+	bool subsumable_types[NUM_CLAUSE_TYPES] = {false};
 	std::for_each(clause_list->begin(), clause_list->end(),
-		[&](Clause* this_clause)
+		[&](Clause* c)
 		{
-			std::list<ClauseType>* clause_types = new std::list<ClauseType>();
-			std::list<IndexNode*>* filtered_clauses = nullptr;
-			std::list<Clause*> removed_clauses;
-			int rank = this_clause->getRight()->getMaximalLiteral()->rank;
-
-			// retrieve a list of subsumable candidate clauses from the index
-			switch(this_clause->getClauseType())
+			if(c->isDead())
 			{
-			case ClauseType::INITIAL:
-				clause_types->push_back(ClauseType::INITIAL);
-				filtered_clauses = clause_index.filterByMinLiteralAndLength(
-					rank, this_clause->size(), clause_types);
-				break;
-
-			case ClauseType::UNIVERSAL:
-				clause_types->push_back(ClauseType::INITIAL);
-				clause_types->push_back(ClauseType::UNIVERSAL);
-				clause_types->push_back(ClauseType::POSITIVE);
-				clause_types->push_back(ClauseType::NEGATIVE);
-				filtered_clauses = clause_index.filterByMinLiteralAndLength(
-					rank, this_clause->size(), clause_types);
-				break;
-
-			case ClauseType::POSITIVE:
-				clause_types->push_back(ClauseType::POSITIVE);
-				filtered_clauses = clause_index.filterByMinLiteralAndLength(
-					rank, this_clause->size(), clause_types);
-				break;
-
-			case ClauseType::NEGATIVE:
-				clause_types->push_back(ClauseType::NEGATIVE);
-				filtered_clauses = clause_index.filterByMinLiteralAndLength(
-					rank, this_clause->size(), clause_types);
-				break;
-
-			case ClauseType::ALL:
-				break;
+				// the clause has since been removed itself
+				return;
 			}
+			subsumers.push_back(c);
+			min_rank = std::min(min_rank, c->getRight()->getMaximalLiteral()->rank);
+			min_size = std::min(min_size, c->size());
+			if(c->getClauseType() == ClauseType::UNIVERSAL)
+			{
+				std::fill(subsumable_types, subsumable_types + NUM_CLAUSE_TYPES,
+					true);
+			}
+			else
+			{
+				subsumable_types[c->getClauseType()] = true;
+			}
+		});
+	if(subsumers.empty())
+	{
+		return;
+	}
 
-			std::for_each(filtered_clauses->begin(), filtered_clauses->end(),
-				[&](IndexNode* node)
+	// archives the given subsumed clause and marks it for removal
+	auto remove_subsumed =
+		[&](Clause* subsumed_clause, Clause* subsumer)
+		{
+			if(g_verbosity >= V_MAXIMAL)
+			{
+				std::cout << DIVIDER_2;
+				std::cout << "Backward subsumption:\n";
+				subsumed_clause->displayClause();
+				std::cout << "Subsumed by:\n";
+				subsumer->displayClause();
+				std::cout << DIVIDER_2;
+			}
+			g_backward_subsumed_count++;
+			if(g_activity_selector != nullptr)
+			{
+				g_activity_selector->bumpClause(subsumer);
+			}
+			g_archive->push_back(subsumed_clause);
+			removed_clauses.insert(subsumed_clause);
+		};
+
+	/* retrieve every bucket that could hold a clause subsumed by one of the
+	   batch, and visit each bucket once checking its clauses against the
+	   whole batch */
+	std::list<ClauseType>* clause_types = new std::list<ClauseType>();
+	for(int i = 0; i < NUM_CLAUSE_TYPES; i++)
+	{
+		if(subsumable_types[i])
+		{
+			clause_types->push_back(static_cast<ClauseType>(i));
+		}
+	}
+	std::list<IndexNode*>* filtered_clauses =
+		clause_index.filterByMinLiteralAndLength(min_rank, min_size,
+			clause_types);
+	std::for_each(filtered_clauses->begin(), filtered_clauses->end(),
+		[&](IndexNode* node)
+		{
+			while(node != nullptr)
+			{
+				Clause* c = node->clause;
+				if(!c->isDead())
 				{
-					//IndexNode* node = *filtered_it;
-					while(node != nullptr)
-					{
-						if(this_clause->subsumes(node->clause))
+					int rank = c->getRight()->getMaximalLiteral()->rank;
+					std::vector<Clause*>::iterator it = std::find_if(
+						subsumers.begin(), subsumers.end(),
+						[&](Clause* subsumer)
 						{
-							/* this indexed clause is subsumed so add it to the
-							   list of clauses to remove and add it to the
-							   archive */
-							if(g_verbosity >= V_MAXIMAL)
+							/* a subsumer removed by this batch is skipped, it may
+							   have been removed by an identical clause that it
+							   would otherwise remove in turn */
+							if(subsumer == c || removed_clauses.count(subsumer) != 0 ||
+								!subsumer->mayForwardSubsume(c) ||
+								subsumer->getRight()->getMaximalLiteral()->rank >
+									rank ||
+								subsumer->size() > c->size())
 							{
-								std::cout << DIVIDER_2;
-								std::cout << "Backward subsumption:\n";
-								node->clause->displayClause();
-								std::cout << "Subsumed by:\n";
-								this_clause->displayClause();
-								std::cout << DIVIDER_2;
+								// this clause is outside the subsumer's range
+								return false;
 							}
-							g_backward_subsumed_count++;
-							g_archive->push_back(node->clause);
-							removed_clauses.push_back(node->clause);
-							if(node->clause->getClauseType()
-								== ClauseType::UNIVERSAL)
-							{
-								u_set->erase(node->clause);
-							}
-							else if(node->clause->getClauseType()
-								== ClauseType::INITIAL)
-							{
-								i_set->erase(node->clause);
-							}
-							else
+							g_backward_subsumption_candidates++;
+							return subsumer->subsumes(c);
+						});
+					if(it != subsumers.end())
+					{
+						remove_subsumed(c, *it);
+					}
+				}
+				node = node->next;
+			}
+		});
+	delete filtered_clauses;
+
+	/* universal clauses can also subsume a coalition clause through its
+	   conjunction, so visit the coalition clauses containing the complement of
+	   each maximal literal once for all the universal clauses sharing it */
+	std::vector<Clause*> universal_subsumers;
+	std::copy_if(subsumers.begin(), subsumers.end(),
+		std::back_inserter(universal_subsumers),
+		[](Clause* c)
+		{
+			return c->getClauseType() == ClauseType::UNIVERSAL;
+		});
+	std::stable_sort(universal_subsumers.begin(), universal_subsumers.end(),
+		[](Clause* this_clause, Clause* that_clause)
+		{
+			return this_clause->getRight()->getMaximalLiteral()->rank <
+				that_clause->getRight()->getMaximalLiteral()->rank;
+		});
+	std::vector<Clause*>::iterator group_begin = universal_subsumers.begin();
+	while(group_begin != universal_subsumers.end())
+	{
+		int rank = (*group_begin)->getRight()->getMaximalLiteral()->rank;
+		std::vector<Clause*>::iterator group_end = std::find_if(group_begin,
+			universal_subsumers.end(),
+			[&](Clause* c)
+			{
+				return c->getRight()->getMaximalLiteral()->rank != rank;
+			});
+		filtered_clauses = clause_index.filterByNegatedLeftLiteral(rank);
+		std::for_each(filtered_clauses->begin(), filtered_clauses->end(),
+			[&](IndexNode* node)
+			{
+				while(node != nullptr)
+				{
+					Clause* c = node->clause;
+					if(!c->isDead() && removed_clauses.count(c) == 0)
+					{
+						// skip the subsumers that have already checked it
+						std::vector<Clause*>::iterator it = std::find_if(
+							group_begin, group_end,
+							[&](Clause* subsumer)
 							{
-								c_set->erase(node->clause);
-							}
+								if(removed_clauses.count(subsumer) != 0 ||
+									(c->getRight()->getMaximalLiteral()->rank >=
+									rank && c->size() >= subsumer->size()))
+								{
+									return false;
+								}
+								g_backward_subsumption_candidates++;
+								return subsumer->subsumes(c);
+							});
+						if(it != group_end)
+						{
+							remove_subsumed(c, *it);
 						}
-						node = node->next;
 					}
-				});
-			// finally remove all of the subsumed clauses from the index
-			std::for_each(removed_clauses.begin(), removed_clauses.end(),
-				[&](Clause* c)
-				{
-					clause_index.removeFromIndex(c);
-				});
-			delete filtered_clauses;
+					node = node->next;
+				}
+			});
+		delete filtered_clauses;
+		group_begin = group_end;
+	}
+
+	/* finally remove all of the subsumed clauses from the index, they are left
+	   in place as dead clauses to be skipped by later scans and selection */
+	std::for_each(removed_clauses.begin(), removed_clauses.end(),
+		[&](Clause* c)
+		{
+			clause_index.lazyRemoveFromIndex(c);
 		});
 }
 
+Clause* clause_list::findSubsumer(Clause* this_clause,
+	ClauseIndex& clause_index)
+{
+	std::list<ClauseType>* clause_types = new std::list<ClauseType>();
+	std::list<IndexNode*>* filtered_clauses = nullptr;
+	std::list<IndexNode*>* temp_clause_list;
+	int rank = this_clause->getRight()->getMaximalLiteral()->rank;
+
+	/* retrieve a list of candidate clauses that could subsume this
+	   clause */
+	switch(this_clause->getClauseType())
+	{
+	case ClauseType::INITIAL:
+		clause_types->push_back(ClauseType::INITIAL);
+		clause_types->push_back(ClauseType::UNIVERSAL);
+		filtered_clauses = clause_index.filterByMaxLiteralAndLength(
+			rank, this_clause->size(), clause_types);
+		break;
+
+	case ClauseType::UNIVERSAL:
+		clause_types->push_back(ClauseType::UNIVERSAL);
+		filtered_clauses = clause_index.filterByMaxLiteralAndLength(
+			rank, this_clause->size(), clause_types);
+		break;
+
+	case ClauseType::POSITIVE:
+		clause_types->push_back(ClauseType::UNIVERSAL);
+		filtered_clauses = clause_index.filterByMaxLiteralAndLength(
+			rank, this_clause->getRight()->size(), clause_types);
+		clause_types = new std::list<ClauseType>();
+		clause_types->push_back(ClauseType::POSITIVE);
+		temp_clause_list = clause_index.filterByMaxLiteralAndLength(
+			rank, this_clause->size(), clause_types);
+		filtered_clauses->splice(filtered_clauses->end(), *temp_clause_list);
+		delete temp_clause_list;
+		/* universal clauses can also subsume this clause through its
+		   conjunction */
+		temp_clause_list = clause_index.filterByNegatedLeft(this_clause,
+			rank, this_clause->getRight()->size());
+		filtered_clauses->splice(filtered_clauses->end(), *temp_clause_list);
+		delete temp_clause_list;
+		break;
+
+	case ClauseType::NEGATIVE:
+		clause_types->push_back(ClauseType::UNIVERSAL);
+		filtered_clauses = clause_index.filterByMaxLiteralAndLength(
+			rank, this_clause->getRight()->size(), clause_types);
+		clause_types = new std::list<ClauseType>();
+		clause_types->push_back(ClauseType::NEGATIVE);
+		temp_clause_list = clause_index.filterByMaxLiteralAndLength(
+			rank, this_clause->size(), clause_types);
+		filtered_clauses->splice(filtered_clauses->end(), *temp_clause_list);
+		delete temp_clause_list;
+		/* universal clauses can also subsume this clause through its
+		   conjunction */
+		temp_clause_list = clause_index.filterByNegatedLeft(this_clause,
+			rank, this_clause->getRight()->size());
+		filtered_clauses->splice(filtered_clauses->end(), *temp_clause_list);
+		delete temp_clause_list;
+		break;
+
+	case ClauseType::ALL:
+		break;
+	}
+
+	Clause* subsumer = nullptr;
+	std::list<IndexNode*>::iterator filtered_it = filtered_clauses->begin();
+	std::list<IndexNode*>::iterator filtered_end = filtered_clauses->end();
+	while(subsumer == nullptr && filtered_it != filtered_end)
+	{
+		IndexNode* node = *filtered_it;
+		while(subsumer == nullptr && node != nullptr)
+		{
+			// a clause stored in the index does not subsume itself
+			if(node->clause != this_clause && !node->clause->isDead() &&
+				node->clause->subsumes(this_clause))
+			{
+				subsumer = node->clause;
+			}
+			node = node->next;
+		}
+		filtered_it++;
+	}
+	delete filtered_clauses;
+	return subsumer;
+}
+
 std::list<Clause*>* clause_list::subsumption(std::list<Clause*>* clause_list,
 	ClauseIndex& clause_index)
 {
@@ -235,326 +458,381 @@ std::list<Clause*>* clause_list::subsumption(std::list<Clause*>* clause_list,
 	std::for_each(clause_list->begin(), clause_list->end(),
 		[&](Clause* this_clause)
 		{
-			std::list<ClauseType>* clause_types = new std::list<ClauseType>();
-			std::list<IndexNode*>* filtered_clauses = nullptr;
-			std::list<IndexNode*>* temp_clause_list;
-			int rank = this_clause->getRight()->getMaximalLiteral()->rank;
+			if(this_clause->getSubsumptionCheckedIndex() == &clause_index)
+			{
+				// the resolvent was not subsumed when it was built
+				not_subsumed->push_back(this_clause);
+				return;
+			}
+			// first try the clauses that recently subsumed other clauses
+			Clause* subsumer = clause_index.findCachedSubsumer(this_clause);
+			if(subsumer != nullptr)
+			{
+				g_subsumer_cache_hits++;
+			}
+			else
+			{
+				g_subsumer_cache_misses++;
+				subsumer = findSubsumer(this_clause, clause_index);
+				if(subsumer != nullptr)
+				{
+					clause_index.cacheSubsumer(subsumer);
+				}
+			}
 
-			/* retrieve a list of candidate clauses that could subsume this
-			   clause */
-			switch(this_clause->getClauseType())
+			if(subsumer == nullptr)
 			{
-			case ClauseType::INITIAL:
-				clause_types->push_back(ClauseType::INITIAL);
-				clause_types->push_back(ClauseType::UNIVERSAL);
-				filtered_clauses = clause_index.filterByMaxLiteralAndLength(
-					rank, this_clause->size(), clause_types);
-				break;
+				not_subsumed->push_back(this_clause);
+				return;
+			}
+			// this clause is subsumed by the indexed clause
+			if(g_verbosity >= V_MAXIMAL)
+			{
+				std::cout << DIVIDER_2;
+				std::cout << "Forward subsumption:\n";
+				this_clause->displayClause();
+				std::cout << "Subsumed by:\n";
+				subsumer->displayClause();
+				std::cout << DIVIDER_2;
+			}
+			g_forward_subsumed_count++;
+			if(g_activity_selector != nullptr)
+			{
+				g_activity_selector->bumpClause(subsumer);
+			}
+			delete this_clause;
+		});
 
-			case ClauseType::UNIVERSAL:
-				clause_types->push_back(ClauseType::UNIVERSAL);
-				filtered_clauses = clause_index.filterByMaxLiteralAndLength(
-					rank, this_clause->size(), clause_types);
-				break;
+	delete clause_list;
+	return not_subsumed;
+}
 
-			case ClauseType::POSITIVE:
-				clause_types->push_back(ClauseType::UNIVERSAL);
-				filtered_clauses = clause_index.filterByMaxLiteralAndLength(
-					rank, this_clause->getRight()->size(), clause_types);
-				clause_types = new std::list<ClauseType>();
-				clause_types->push_back(ClauseType::POSITIVE);
-				temp_clause_list = clause_index.filterByMaxLiteralAndLength(
-					rank, this_clause->size(), clause_types);
-				filtered_clauses->splice(filtered_clauses->end(), *temp_clause_list);
-				delete temp_clause_list;
-				break;
 
-			case ClauseType::NEGATIVE:
-				clause_types->push_back(ClauseType::UNIVERSAL);
-				filtered_clauses = clause_index.filterByMaxLiteralAndLength(
-					rank, this_clause->getRight()->size(), clause_types);
-				clause_types = new std::list<ClauseType>();
-				clause_types->push_back(ClauseType::NEGATIVE);
-				temp_clause_list = clause_index.filterByMaxLiteralAndLength(
-					rank, this_clause->size(), clause_types);
-				filtered_clauses->splice(filtered_clauses->end(), *temp_clause_list);
-				delete temp_clause_list;
-				break;
+std::list<Clause*>* clause_list::subsumptionResolution(
+	std::list<Clause*>* clause_list, ClauseIndex& clause_index)
+{
+	// we will add the clauses, or the clauses they are reduced to, to this list
+	std::list<Clause*>* reduced = new std::list<Clause*>();
 
-			case ClauseType::ALL:
-				break;
+	// returns a clause in the index that can remove a literal from the clause
+	auto find_premise =
+		[&](Clause* this_clause, Literal*& literal) -> Clause*
+		{
+			if(this_clause->getRight()->size() == 0)
+			{
+				return nullptr;
 			}
-
-			bool subsumed = false;
+			std::list<ClauseType>* clause_types = new std::list<ClauseType>();
+			clause_types->push_back(ClauseType::UNIVERSAL);
+			if(this_clause->getClauseType() == ClauseType::INITIAL)
+			{
+				clause_types->push_back(ClauseType::INITIAL);
+			}
+			/* the maximal literal of a premise is either in the disjunction of
+			   this clause or is the complement of a literal in it */
+			int rank = 0;
+			std::for_each(this_clause->getRight()->getList()->begin(),
+				this_clause->getRight()->getList()->end(),
+				[&](Literal* l)
+				{
+					rank = std::max(rank,
+						std::max(l->rank, l->complementary_literal->rank));
+				});
+			std::list<IndexNode*>* filtered_clauses =
+				clause_index.filterByMaxLiteralAndLength(rank,
+					this_clause->getRight()->size(), clause_types);
+			Clause* premise = nullptr;
 			std::list<IndexNode*>::iterator filtered_it = filtered_clauses->begin();
 			std::list<IndexNode*>::iterator filtered_end = filtered_clauses->end();
-			while(!subsumed && filtered_it != filtered_end)
+			while(premise == nullptr && filtered_it != filtered_end)
 			{
 				IndexNode* node = *filtered_it;
-				while(!subsumed && node != nullptr)
+				while(premise == nullptr && node != nullptr)
 				{
-					if(node->clause->subsumes(this_clause))
+					if(!node->clause->isDead())
 					{
-						// this clause is subsumed by the indexed clause
-						subsumed = true;
-						if(g_verbosity >= V_MAXIMAL)
+						literal = node->clause->subsumptionResolves(this_clause);
+						if(literal != nullptr)
 						{
-							std::cout << DIVIDER_2;
-							std::cout << "Forward subsumption:\n";
-							this_clause->displayClause();
-							std::cout << "Subsumed by:\n";
-							node->clause->displayClause();
-							std::cout << DIVIDER_2;
+							premise = node->clause;
 						}
 					}
 					node = node->next;
 				}
 				filtered_it++;
 			}
+			delete filtered_clauses;
+			return premise;
+		};
 
-			if(!subsumed)
-			{
-				not_subsumed->push_back(this_clause);
-			}
-			else
+	std::for_each(clause_list->begin(), clause_list->end(),
+		[&](Clause* this_clause)
+		{
+			Clause* premise;
+			Literal* literal;
+			// keep removing literals until no premise is found
+			while(g_contradiction == nullptr &&
+				(premise = find_premise(this_clause, literal)) != nullptr)
 			{
-				g_forward_subsumed_count++;
-				delete this_clause;
+				if(g_verbosity >= V_MAXIMAL)
+				{
+					std::cout << DIVIDER_2;
+					std::cout << "Forward subsumption resolution:\n";
+					this_clause->displayClause();
+					std::cout << "Resolved with:\n";
+					premise->displayClause();
+					std::cout << DIVIDER_2;
+				}
+				g_forward_subsumption_resolutions++;
+				// the reduced clause is justified by the archived clause
+				g_archive->push_back(this_clause);
+				this_clause = this_clause->subsumptionResolvent(premise, literal);
+				if(this_clause->size() == 0)
+				{
+					// a contradiction has been derived
+					g_contradiction = this_clause;
+					return;
+				}
+				this_clause->assignIdentifier();
 			}
-
-			delete filtered_clauses;
+			reduced->push_back(this_clause);
 		});
 
 	delete clause_list;
-	return not_subsumed;
+	return reduced;
 }
 
-std::list<Clause*>* clause_list::selfSubsumption(std::list<Clause*>* clause_list,
-	ClauseIndex& clause_index)
+void clause_list::backwardSubsumptionResolution(
+	std::list<Clause*>* clause_list, ClauseIndex& clause_index)
 {
-	clause_list::sortClauseList(clause_list);
-	std::list<Clause*>* not_subsumed = new std::list<Clause*>();
-	std::list<Clause*>::iterator clauses_it = clause_list->begin();
-	std::list<Clause*>::iterator clauses_end = clause_list->end();
-	while(clauses_it != clauses_end)
-	{
-		Clause* this_clause = *clauses_it;
-		std::list<ClauseType>* clause_types = new std::list<ClauseType>();
-		std::list<IndexNode*>* filtered_clauses = nullptr;
-		std::list<IndexNode*>* temp_clause_list;
-		int rank = this_clause->getRight()->getMaximalLiteral()->rank;
-
-		// retrieve a list of candidate clauses that could subsume this clause
-		switch(this_clause->getClauseType())
+	std::list<Clause*> reduced;
+	std::for_each(clause_list->begin(), clause_list->end(),
+		[&](Clause* this_clause)
 		{
-		case ClauseType::INITIAL:
+			if(g_contradiction != nullptr ||
+				(this_clause->getClauseType() != ClauseType::UNIVERSAL &&
+				this_clause->getClauseType() != ClauseType::INITIAL))
+			{
+				// only universal and initial clauses are premises
+				return;
+			}
+			std::list<ClauseType>* clause_types = new std::list<ClauseType>();
 			clause_types->push_back(ClauseType::INITIAL);
-			clause_types->push_back(ClauseType::UNIVERSAL);
-			filtered_clauses = clause_index.filterByMaxLiteralAndLength(
-				rank, this_clause->size(), clause_types);
-			break;
-
-		case ClauseType::UNIVERSAL:
-			clause_types->push_back(ClauseType::UNIVERSAL);
-			filtered_clauses = clause_index.filterByMaxLiteralAndLength(
-				rank, this_clause->size(), clause_types);
-			break;
-
-		case ClauseType::POSITIVE:
-			clause_types->push_back(ClauseType::UNIVERSAL);
-			filtered_clauses = clause_index.filterByMaxLiteralAndLength(
-				rank, this_clause->getRight()->size(), clause_types);
-			clause_types = new std::list<ClauseType>();
-			clause_types->push_back(ClauseType::POSITIVE);
-			temp_clause_list = clause_index.filterByMaxLiteralAndLength(
-				rank, this_clause->size(), clause_types);
-			filtered_clauses->splice(filtered_clauses->end(), *temp_clause_list);
-			delete temp_clause_list;
-			break;
-
-		case ClauseType::NEGATIVE:
-			clause_types->push_back(ClauseType::UNIVERSAL);
-			filtered_clauses = clause_index.filterByMaxLiteralAndLength(
-				rank, this_clause->getRight()->size(), clause_types);
-			clause_types = new std::list<ClauseType>();
-			clause_types->push_back(ClauseType::NEGATIVE);
-			temp_clause_list = clause_index.filterByMaxLiteralAndLength(
-				rank, this_clause->size(), clause_types);
-			filtered_clauses->splice(filtered_clauses->end(), *temp_clause_list);
-			delete temp_clause_list;
-			break;
-
-		case ClauseType::ALL:
-			break;
-		}
-
-		bool subsumed = false;
-		std::list<IndexNode*>::iterator filtered_it = filtered_clauses->begin();
-		std::list<IndexNode*>::iterator filtered_end = filtered_clauses->end();
-		while(!subsumed && filtered_it != filtered_end)
-		{
-			IndexNode* node = *filtered_it;
-			while(!subsumed && node != nullptr)
+			if(this_clause->getClauseType() == ClauseType::UNIVERSAL)
 			{
-				if(node->clause->subsumes(this_clause))
+				clause_types->push_back(ClauseType::UNIVERSAL);
+				clause_types->push_back(ClauseType::POSITIVE);
+				clause_types->push_back(ClauseType::NEGATIVE);
+			}
+			/* a candidate contains the maximal literal of this clause or its
+			   complement, which has a rank at most one less */
+			std::list<IndexNode*>* filtered_clauses =
+				clause_index.filterByMinLiteralAndLength(
+					this_clause->getRight()->getMaximalLiteral()->rank - 1,
+					this_clause->size(), clause_types);
+			std::list<std::pair<Clause*, Literal*>> resolved_clauses;
+			std::for_each(filtered_clauses->begin(), filtered_clauses->end(),
+				[&](IndexNode* node)
 				{
-					// this clause is subsumed by the indexed clause
-					subsumed = true;
-					if(g_verbosity >= V_MAXIMAL)
+					while(node != nullptr)
 					{
-						std::cout << DIVIDER_2;
-						std::cout << "Forward subsumption:\n";
-						this_clause->displayClause();
-						std::cout << "Subsumed by:\n";
-						node->clause->displayClause();
-						std::cout << DIVIDER_2;
+						if(!node->clause->isDead())
+						{
+							Literal* literal =
+								this_clause->subsumptionResolves(node->clause);
+							if(literal != nullptr)
+							{
+								resolved_clauses.push_back(
+									std::make_pair(node->clause, literal));
+							}
+						}
+						node = node->next;
 					}
+				});
+			delete filtered_clauses;
+			/* replace each indexed clause that can be reduced, the reduced
+			   clauses are added to the list */
+			std::list<std::pair<Clause*, Literal*>>::iterator it =
+				resolved_clauses.begin();
+			while(g_contradiction == nullptr && it != resolved_clauses.end())
+			{
+				Clause* indexed_clause = it->first;
+				if(g_verbosity >= V_MAXIMAL)
+				{
+					std::cout << DIVIDER_2;
+					std::cout << "Backward subsumption resolution:\n";
+					indexed_clause->displayClause();
+					std::cout << "Resolved with:\n";
+					this_clause->displayClause();
+					std::cout << DIVIDER_2;
 				}
-				node = node->next;
+				g_backward_subsumption_resolutions++;
+				clause_index.lazyRemoveFromIndex(indexed_clause);
+				g_archive->push_back(indexed_clause);
+				Clause* resolvent =
+					indexed_clause->subsumptionResolvent(this_clause, it->second);
+				if(resolvent->size() == 0)
+				{
+					// a contradiction has been derived
+					g_contradiction = resolvent;
+				}
+				else
+				{
+					resolvent->assignIdentifier();
+					reduced.push_back(resolvent);
+				}
+				it++;
 			}
-			filtered_it++;
-		}
-
-		if(!subsumed)
-		{
-			// this clause was not subsumed so it is added to the index
-			not_subsumed->push_back(this_clause);
-			clause_index.addToIndex(this_clause);
-			clauses_it++;
-		}
-		else
-		{
-			/* this clause was subsumed; forward subsumed clauses are discarded
-			   so delete it */
-			g_forward_subsumed_count++;
-			delete *clauses_it;
-			clauses_it = clause_list->erase(clauses_it);
-		}
-
-		delete filtered_clauses;
-	}
-
-	// finally remove all of the clauses from the index
-	std::for_each(clause_list->begin(), clause_list->end(),
-		[&](Clause* c)
-		{
-			clause_index.removeFromIndex(c);
 		});
+	clause_list->splice(clause_list->end(), reduced);
+}
 
-	delete clause_list;
-	return not_subsumed;
+std::list<Clause*>* clause_list::selfSubsumption(std::list<Clause*>* clause_list)
+{
+	return batchSelfSubsumption(clause_list, &Clause::subsumes);
 }
 
-std::list<Clause*>* clause_list::initialSelfSubsumption(std::list<Clause*>* clause_list,
-	ClauseIndex& clause_index)
+std::list<Clause*>* clause_list::initialSelfSubsumption(
+	std::list<Clause*>* clause_list)
 {
-	clause_list::sortClauseList(clause_list);
-	std::list<Clause*>* not_subsumed = new std::list<Clause*>();
-	std::list<Clause*>::iterator clauses_it = clause_list->begin();
-	std::list<Clause*>::iterator clauses_end = clause_list->end();
-	while(clauses_it != clauses_end)
+	return batchSelfSubsumption(clause_list, &Clause::initialSubsumes);
+}
+
+std::list<Clause*>* clause_list::batchSelfSubsumption(
+	std::list<Clause*>* clause_list, bool (Clause::*subsumes)(Clause*))
+{
+	/* a surviving clause together with the signatures of its disjunction, its
+	   conjunction and the negation of its conjunction */
+	struct BatchEntry
 	{
-		Clause* this_clause = *clauses_it;
-		std::list<ClauseType>* clause_types = new std::list<ClauseType>();
-		std::list<IndexNode*>* filtered_clauses = nullptr;
-		std::list<IndexNode*>* temp_clause_list;
-		int rank = this_clause->getRight()->getMaximalLiteral()->rank;
-
-		// retrieve a list of candidate clauses that could subsume this clause
-		switch(this_clause->getClauseType())
+		Clause* clause;
+		uint64_t right;
+		uint64_t left;
+		uint64_t negated_left;
+	};
+	auto signature = [](LiteralList* literals, bool negate)
 		{
-		case ClauseType::INITIAL:
-			clause_types->push_back(ClauseType::INITIAL);
-			clause_types->push_back(ClauseType::UNIVERSAL);
-			filtered_clauses = clause_index.filterByMaxLiteralAndLength(
-				rank, this_clause->size(), clause_types);
-			break;
-
-		case ClauseType::UNIVERSAL:
-			clause_types->push_back(ClauseType::UNIVERSAL);
-			filtered_clauses = clause_index.filterByMaxLiteralAndLength(
-				rank, this_clause->size(), clause_types);
-			break;
-
-		case ClauseType::POSITIVE:
-			clause_types->push_back(ClauseType::UNIVERSAL);
-			filtered_clauses = clause_index.filterByMaxLiteralAndLength(
-				rank, this_clause->getRight()->size(), clause_types);
-			clause_types = new std::list<ClauseType>();
-			clause_types->push_back(ClauseType::POSITIVE);
-			temp_clause_list = clause_index.filterByMaxLiteralAndLength(
-				rank, this_clause->size(), clause_types);
-			filtered_clauses->splice(filtered_clauses->end(), *temp_clause_list);
-			delete temp_clause_list;
-			break;
-
-		case ClauseType::NEGATIVE:
-			clause_types->push_back(ClauseType::UNIVERSAL);
-			filtered_clauses = clause_index.filterByMaxLiteralAndLength(
-				rank, this_clause->getRight()->size(), clause_types);
-			clause_types = new std::list<ClauseType>();
-			clause_types->push_back(ClauseType::NEGATIVE);
-			temp_clause_list = clause_index.filterByMaxLiteralAndLength(
-				rank, this_clause->size(), clause_types);
-			filtered_clauses->splice(filtered_clauses->end(), *temp_clause_list);
-			delete temp_clause_list;
-			break;
-
-		case ClauseType::ALL:
-			break;
-		}
+			uint64_t signature = 0;
+			if(literals->getList() != nullptr)
+			{
+				std::for_each(literals->getList()->begin(),
+					literals->getList()->end(),
+					[&](Literal* l)
+					{
+						int rank = negate ? l->complementary_literal->rank :
+							l->rank;
+						signature |= static_cast<uint64_t>(1) << (rank & 63);
+					});
+			}
+			return signature;
+		};
 
-		bool subsumed = false;
-		std::list<IndexNode*>::iterator filtered_it = filtered_clauses->begin();
-		std::list<IndexNode*>::iterator filtered_end = filtered_clauses->end();
-		while(!subsumed && filtered_it != filtered_end)
+	/* after sorting a clause can only be subsumed by an earlier clause, so
+	   each clause is checked against the survivors so far, which are kept in
+	   a table by clause type and by the rank of their maximal literal, with
+	   rank 0 for an empty disjunction */
+	clause_list::sortClauseList(clause_list);
+	std::list<Clause*>* not_subsumed = new std::list<Clause*>();
+	std::unordered_map<int, std::vector<BatchEntry>>
+		survivors[NUM_CLAUSE_TYPES];
+	// the first surviving clause of each type
+	Clause* first_survivor[NUM_CLAUSE_TYPES] = {};
+	std::for_each(clause_list->begin(), clause_list->end(),
+		[&](Clause* this_clause)
 		{
-			IndexNode* node = *filtered_it;
-			while(!subsumed && node != nullptr)
+			BatchEntry entry = {this_clause,
+				signature(this_clause->getRight(), false),
+				signature(this_clause->getLeft(), false),
+				signature(this_clause->getLeft(), true)};
+			Clause* subsumer = nullptr;
+			int type = 0;
+			// checks the survivors of the current type with the given rank
+			auto check_rank = [&](int rank)
+				{
+					std::unordered_map<int, std::vector<BatchEntry>>::iterator
+						found = survivors[type].find(rank);
+					if(found == survivors[type].end())
+					{
+						return;
+					}
+					std::vector<BatchEntry>::iterator it =
+						found->second.begin();
+					std::vector<BatchEntry>::iterator end = found->second.end();
+					while(subsumer == nullptr && it != end)
+					{
+						/* the signatures must be compatible before we look
+						   closer */
+						if((((it->right & ~entry.right) == 0 &&
+							(it->left & ~entry.left) == 0) ||
+							(type == ClauseType::UNIVERSAL &&
+							(it->right & ~entry.negated_left) == 0)) &&
+							(it->clause->*subsumes)(this_clause))
+						{
+							subsumer = it->clause;
+						}
+						it++;
+					}
+				};
+			for(; subsumer == nullptr && type < NUM_CLAUSE_TYPES; type++)
 			{
-				if(node->clause->initialSubsumes(this_clause))
+				if(first_survivor[type] == nullptr ||
+					!first_survivor[type]->mayForwardSubsume(this_clause))
 				{
-					// this clause is subsumed by the indexed clause
-					subsumed = true;
-					if(g_verbosity >= V_MAXIMAL)
+					continue;
+				}
+				/* the maximal literal of a subsumer is in the disjunction of
+				   this clause or, for a universal subsumer, in the negation of
+				   its conjunction */
+				check_rank(0);
+				std::list<Literal*>* right = this_clause->getRight()->getList();
+				if(right != nullptr)
+				{
+					for(std::list<Literal*>::iterator it = right->begin();
+						subsumer == nullptr && it != right->end(); it++)
 					{
-						std::cout << DIVIDER_2;
-						std::cout << "Forward subsumption:\n";
-						this_clause->displayClause();
-						std::cout << "Subsumed by:\n";
-						node->clause->displayClause();
-						std::cout << DIVIDER_2;
+						check_rank((*it)->rank);
+					}
+				}
+				std::list<Literal*>* left = this_clause->getLeft()->getList();
+				if(type == ClauseType::UNIVERSAL && left != nullptr)
+				{
+					for(std::list<Literal*>::iterator it = left->begin();
+						subsumer == nullptr && it != left->end(); it++)
+					{
+						check_rank((*it)->complementary_literal->rank);
 					}
 				}
-				node = node->next;
 			}
-			filtered_it++;
-		}
-
-		if(!subsumed)
-		{
-			// this clause was not subsumed so it is added to the index
-			not_subsumed->push_back(this_clause);
-			clause_index.addToIndex(this_clause);
-			clauses_it++;
-		}
-		else
-		{
-			/* this clause was subsumed; forward subsumed clauses are discarded
-				so delete it */
-			g_forward_subsumed_count++;
-			delete *clauses_it;
-			clauses_it = clause_list->erase(clauses_it);
-		}
-
-		delete filtered_clauses;
-	}
 
-	// finally remove all of the clauses from the index
-	std::for_each(clause_list->begin(), clause_list->end(),
-		[&](Clause* c)
-		{
-			clause_index.removeFromIndex(c);
+			if(subsumer == nullptr)
+			{
+				// this clause was not subsumed so it can subsume later clauses
+				not_subsumed->push_back(this_clause);
+				Literal* maximal = this_clause->getRight()->getMaximalLiteral();
+				int this_type = this_clause->getClauseType();
+				int rank = maximal == nullptr ? 0 : maximal->rank;
+				survivors[this_type][rank].push_back(entry);
+				if(first_survivor[this_type] == nullptr)
+				{
+					first_survivor[this_type] = this_clause;
+				}
+			}
+			else
+			{
+				if(g_verbosity >= V_MAXIMAL)
+				{
+					std::cout << DIVIDER_2;
+					std::cout << "Forward subsumption:\n";
+					this_clause->displayClause();
+					std::cout << "Subsumed by:\n";
+					subsumer->displayClause();
+					std::cout << DIVIDER_2;
+				}
+				/* this clause was subsumed; forward subsumed clauses are
+				   discarded so delete it */
+				g_forward_subsumed_count++;
+				delete this_clause;
+			}
 		});
 
 	delete clause_list;
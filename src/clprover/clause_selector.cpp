@@ -0,0 +1,149 @@
+/*==============================================================================
+	File			: clause_selector.cpp
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 18/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#include <algorithm>
+#include <iostream>
+
+#include "clprover/clause_selector.h"
+#include "clprover/define.h"
+
+#include "data_structures/clause.h"
+#include "data_structures/literal.h"
+#include "data_structures/literal_list.h"
+
+/*==============================================================================
+	Constructors/Deconstructor
+==============================================================================*/
+ClauseSelector::ClauseSelector(int weight_function, int weight_ratio):
+	weight_function(weight_function), weight_ratio(weight_ratio)
+{
+}
+
+/*==============================================================================
+	Public Functions
+==============================================================================*/
+void ClauseSelector::addClause(Clause* clause)
+{
+	age_queue.push(clause);
+	weight_queue.push_back({weight(clause, weight_function), clauses_added++,
+		clause});
+	std::push_heap(weight_queue.begin(), weight_queue.end());
+}
+
+Clause* ClauseSelector::getNext()
+{
+	Clause* next = nullptr;
+	if(weight_selections < weight_ratio)
+	{
+		next = popWeight();
+		if(next != nullptr)
+		{
+			weight_selections++;
+			selected_by_weight++;
+			return next;
+		}
+	}
+	// it is the turn of the age queue, or the weight queue is exhausted
+	next = popAge();
+	if(next != nullptr)
+	{
+		weight_selections = 0;
+		selected_by_age++;
+	}
+	return next;
+}
+
+int ClauseSelector::weight(Clause* clause, int weight_function)
+{
+	switch(weight_function)
+	{
+	case WEIGHT_TYPE_SIZE:
+		// coalition clauses are heavier than initial and universal clauses
+		switch(clause->getClauseType())
+		{
+		case ClauseType::UNIVERSAL:
+			return clause->size() * TYPE_WEIGHT_UNIVERSAL;
+		case ClauseType::INITIAL:
+			return clause->size() * TYPE_WEIGHT_INITIAL;
+		default:
+			return clause->size() * TYPE_WEIGHT_COALITION;
+		}
+
+	case WEIGHT_AGENT_PENALTY:
+		return clause->size() + (clause->getAgents() == nullptr ? 0 :
+			clause->getAgents()->size() * AGENT_WEIGHT_PENALTY);
+
+	case WEIGHT_MAX_LITERAL:
+		return clause->getRight()->size() == 0 ? 0 :
+			clause->getRight()->getMaximalLiteral()->rank;
+
+	default:
+		return clause->size();
+	}
+}
+
+void ClauseSelector::displayStatistics() const
+{
+	std::cout << "Clauses selected by weight: " << selected_by_weight <<
+		std::endl;
+	std::cout << "Clauses selected by age: " << selected_by_age << std::endl;
+	std::cout << "Stale selection queue entries skipped: " <<
+		entries_skipped << std::endl;
+}
+
+/*==============================================================================
+	Private Functions
+==============================================================================*/
+Clause* ClauseSelector::popAge()
+{
+	while(!age_queue.empty())
+	{
+		Clause* clause = age_queue.pop();
+		if(!clause->isSaturated() && !clause->isDead())
+		{
+			return clause;
+		}
+		entries_skipped++;
+	}
+	return nullptr;
+}
+
+Clause* ClauseSelector::popWeight()
+{
+	while(!weight_queue.empty())
+	{
+		std::pop_heap(weight_queue.begin(), weight_queue.end());
+		Clause* clause = weight_queue.back().clause;
+		weight_queue.pop_back();
+		if(!clause->isSaturated() && !clause->isDead())
+		{
+			return clause;
+		}
+		entries_skipped++;
+	}
+	return nullptr;
+}
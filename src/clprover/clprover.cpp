@@ -7,7 +7,7 @@
 	File			: clprover.cpp
 	Author			: Paul Gainer
 	Created			: 16/06/2014
-	Last modified	: 18/04/2015
+	Last modified	: 19/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -33,20 +33,31 @@
 #include <algorithm>
 #include <ctime>
 #include <climits>
+#include <functional>
 #include <iostream>
+#include <map>
 #include <queue>
 #include <set>
+#include <string>
+#include <vector>
 
+#include "clprover/activity_selector.h"
 #include "clprover/clause_list.h"
+#include "clprover/clause_selector.h"
 #include "clprover/define.h"
 #include "clprover/global.h"
+#include "clprover/goal_distance_selector.h"
+#include "clprover/literal_ordering.h"
 #include "clprover/parsing.h"
+#include "clprover/simplification_scheduler.h"
+#include "clprover/symmetry_detector.h"
 
 #include "command_line_parser/command_line_parser.h"
 #include "command_line_parser/parser_option_type.h"
 
 #include "data_structures/clause.h"
 #include "data_structures/clause_index.h"
+#include "data_structures/clause_queue.h"
 #include "data_structures/justification.h"
 #include "data_structures/list_literal_iterator_pair.h"
 #include "data_structures/literal.h"
@@ -54,10 +65,22 @@
 /*==============================================================================
 	Function Prototypes
 ==============================================================================*/
-void resolution(std::list<Clause*>*);
+void resolution(std::list<Clause*>*, SimplificationScheduler*,
+	SimplificationScheduler*, ClauseSelector*, GoalDistanceSelector*,
+	SymmetryDetector*, literal_ordering::ProbeResult* = nullptr);
+std::vector<Literal*> tuneOrdering(std::list<Clause*>*,
+	const std::map<Literal*, std::vector<Literal*>>&, int&);
+void resetStatistics();
+void scheduledBackwardSubsumption(std::list<Clause*>*, ClauseIndex&,
+	SimplificationScheduler*);
+bool givenClauseSubsumed(Clause*, ClauseIndex&, ClauseIndex&);
 void unitPropagation(std::list<Clause*>*);
 std::list<Clause*>* propagateUnitClause(std::list<Clause*>*, Clause*);
 void purityDeletion(std::list<Clause*>*);
+void splitLongClauses(std::list<Clause*>*,
+	std::map<Literal*, std::vector<Literal*>>&);
+std::vector<Literal*> placeSplitNames(const std::vector<Literal*>&,
+	const std::map<Literal*, std::vector<Literal*>>&);
 void cleanup();
 void displayArchive();
 void displayTitle(const std::string&);
@@ -71,6 +94,12 @@ int main(int argc, char** argv)
 	std::string input_file_name;
 	// the optional file defining the literal ordering
 	std::string ordering_file_name = "";
+	// the optional file to which the literal ordering is written
+	std::string ordering_output_file_name = "";
+	// the optional file listing input clauses in the set of support
+	std::string support_file_name = "";
+	// the literal ordering generator chosen by tuning
+	int tuned_generator = ORDER_INPUT;
 
 	/* set up a new command line parser, an input file is required but all
 	   other features are optional; defaults are forward subsumption enabled
@@ -93,6 +122,34 @@ int main(int argc, char** argv)
 		std::string("disable/enable backward subsumption\n") +
 		std::string("\t\t\tdefault: disabled\n"), CommandLineParser::OPTIONAL,
 		&g_backward_subsumption);
+	parser.addBoolOption("-r",
+		std::string("disable/enable subsumption resolution\n") +
+		std::string("\t\t\tdefault: disabled\n"), CommandLineParser::OPTIONAL,
+		&g_subsumption_resolution);
+	parser.addBoolOption("-d",
+		std::string("disable/enable adaptive scheduling of backward\n") +
+		std::string("\t\t\tsubsumption\n") +
+		std::string("\t\t\tdefault: disabled\n"), CommandLineParser::OPTIONAL,
+		&g_adaptive_scheduling);
+	parser.addBoolOption("-m",
+		std::string("disable/enable literal bitmasks, which are exact for\n") +
+		std::string("\t\t\tinputs with at most 128 literals\n") +
+		std::string("\t\t\tdefault: enabled\n"), CommandLineParser::OPTIONAL,
+		&g_literal_masks);
+	parser.addBoolOption("-s",
+		std::string("disable/enable a single index for saturated and passive\n") +
+		std::string("\t\t\tclauses\n") +
+		std::string("\t\t\tdefault: disabled\n"), CommandLineParser::OPTIONAL,
+		&g_unified_index);
+	parser.addBoolOption("-t",
+		std::string("disable/enable coalition clauses in the set of support\n") +
+		std::string("\t\t\tdefault: disabled\n"), CommandLineParser::OPTIONAL,
+		&g_coalition_support);
+	parser.addBoolOption("-y",
+		std::string("disable/enable hyperresolution between universal and\n") +
+		std::string("\t\t\tinitial clauses, selecting every negative literal\n") +
+		std::string("\t\t\tdefault: disabled\n"), CommandLineParser::OPTIONAL,
+		&g_hyperresolution);
 	parser.addBoolOption("-c",
 		std::string("display modality as vector\n") +
 		std::string("\t\t\tdefault: disabled\n"), CommandLineParser::OPTIONAL,
@@ -113,8 +170,89 @@ int main(int argc, char** argv)
 		std::string("select heuristic\n") +
 		std::string("\t\t\t0: select smallest clause\n") +
 		std::string("\t\t\t1: select clause by type\n") +
+		std::string("\t\t\t2: select clause by weight and age\n") +
+		std::string("\t\t\t3: select clause by literal activity\n") +
+		std::string("\t\t\t4: select clause by distance from initial\n") +
+		std::string("\t\t\tclauses and size\n") +
 		std::string("\t\t\tdefault: select smallest clause\n"),
-		CommandLineParser::OPTIONAL, &g_heuristic, GET_NEXT_SMALLEST, GET_NEXT);
+		CommandLineParser::OPTIONAL, &g_heuristic, GET_NEXT_SMALLEST,
+		GOAL_DISTANCE);
+	parser.addIntRangeOption("-e",
+		std::string("select set of support strategy\n") +
+		std::string("\t\t\t0: disabled\n") +
+		std::string("\t\t\t1: complete, unsupported clauses are resolved\n") +
+		std::string("\t\t\twith each other once the supported clauses are\n") +
+		std::string("\t\t\tsaturated\n") +
+		std::string("\t\t\t2: incomplete, unsupported clauses are never\n") +
+		std::string("\t\t\tresolved with each other\n") +
+		std::string("\t\t\tdefault: disabled\n"),
+		CommandLineParser::OPTIONAL, &g_set_of_support, SOS_DISABLED,
+		SOS_INCOMPLETE);
+	parser.addIntRangeOption("-w",
+		std::string("select clause weight function for heuristic 2\n") +
+		std::string("\t\t\t0: number of literals\n") +
+		std::string("\t\t\t1: number of literals weighted by clause type\n") +
+		std::string("\t\t\t2: number of literals plus agent penalty\n") +
+		std::string("\t\t\t3: rank of maximal literal\n") +
+		std::string("\t\t\tdefault: number of literals\n"),
+		CommandLineParser::OPTIONAL, &g_weight_function, WEIGHT_SYMBOL_COUNT,
+		WEIGHT_MAX_LITERAL);
+	parser.addIntRangeOption("-q",
+		std::string("set number of clauses selected by weight or activity\n") +
+		std::string("\t\t\tfor each clause selected by age for heuristics 2\n") +
+		std::string("\t\t\tand 3\n") +
+		std::string("\t\t\tdefault: 5\n"),
+		CommandLineParser::OPTIONAL, &g_weight_ratio, 0, INT_MAX);
+	parser.addIntRangeOption("-n",
+		std::string("select literal selection function for universal and\n") +
+		std::string("\t\t\tinitial clauses\n") +
+		std::string("\t\t\t0: no selection, resolve upon maximal literal\n") +
+		std::string("\t\t\t1: select maximal negative literal\n") +
+		std::string("\t\t\t2: select negative literal with fewest\n") +
+		std::string("\t\t\toccurrences\n") +
+		std::string("\t\t\t3: select all negative literals\n") +
+		std::string("\t\t\tdefault: no selection\n"),
+		CommandLineParser::OPTIONAL, &g_literal_selection, SELECT_MAXIMAL,
+		SELECT_ALL_NEGATIVE);
+	parser.addIntRangeOption("-z",
+		std::string("select literal ordering generator, ignored if a\n") +
+		std::string("\t\t\tliteral ordering file is set\n") +
+		std::string("\t\t\t0: order of appearance in the input\n") +
+		std::string("\t\t\t1: least frequent literals greatest\n") +
+		std::string("\t\t\t2: literals of initial clauses greatest, then by\n") +
+		std::string("\t\t\tdistance from them\n") +
+		std::string("\t\t\t3: reverse Cuthill-McKee\n") +
+		std::string("\t\t\t4: the ordering of 0-3 making the most progress\n") +
+		std::string("\t\t\tin short probing runs\n") +
+		std::string("\t\t\tdefault: order of appearance\n"),
+		CommandLineParser::OPTIONAL, &g_literal_ordering, ORDER_INPUT,
+		ORDER_TUNED);
+	parser.addIntRangeOption("-j",
+		std::string("split universal and initial clauses with more than\n") +
+		std::string("\t\t\tn literals into clauses with at most n literals,\n") +
+		std::string("\t\t\tnaming the shared components with new literals\n") +
+		std::string("\t\t\tdefault: disabled\n"),
+		CommandLineParser::OPTIONAL, &g_split_length, SPLIT_MIN_LENGTH,
+		INT_MAX);
+	parser.addIntRangeOption("-g",
+		std::string("add the images under the symmetries of the input of\n") +
+		std::string("\t\t\tselected derived clauses with at most n literals,\n") +
+		std::string("\t\t\trequires forward subsumption\n") +
+		std::string("\t\t\tdefault: disabled\n"),
+		CommandLineParser::OPTIONAL, &g_symmetry_length, 1, INT_MAX);
+	parser.addIntRangeOption("-l",
+		std::string("select given clause loop\n") +
+		std::string("\t\t\t0: Otter-style, simplify resolvents against all\n") +
+		std::string("\t\t\tclauses\n") +
+		std::string("\t\t\t1: DISCOUNT-style, simplify resolvents against\n") +
+		std::string("\t\t\tsaturated clauses and recheck selected clauses\n") +
+		std::string("\t\t\tdefault: Otter-style\n"),
+		CommandLineParser::OPTIONAL, &g_loop_style, OTTER_LOOP, DISCOUNT_LOOP);
+	parser.addIntRangeOption("-k",
+		std::string("set number of given clauses whose resolvents are\n") +
+		std::string("\t\t\tbatched for backward subsumption\n") +
+		std::string("\t\t\tdefault: 1\n"),
+		CommandLineParser::OPTIONAL, &g_backward_batch_size, 1, INT_MAX);
 	parser.addIntRangeOption("-a",
 		std::string("set number of agents\n"),
 		CommandLineParser::OPTIONAL, &g_num_agents, 1, INT_MAX);
@@ -122,6 +260,11 @@ int main(int argc, char** argv)
 		CommandLineParser::REQUIRED, &input_file_name, "file");
 	parser.addStringOption("-o", "set literal ordering file\n",
 		CommandLineParser::OPTIONAL, &ordering_file_name, "file");
+	parser.addStringOption("-O", "write literal ordering to file\n",
+		CommandLineParser::OPTIONAL, &ordering_output_file_name, "file");
+	parser.addStringOption("-T",
+		"set file of input clauses added to the set of support\n",
+		CommandLineParser::OPTIONAL, &support_file_name, "file");
 	if(argc == 1)
 	{
 		// no arguments so display some info
@@ -133,10 +276,39 @@ int main(int argc, char** argv)
 		// there was a parse error
 		return 0;
 	}
+	if(g_hyperresolution && g_literal_selection != SELECT_MAXIMAL &&
+		g_literal_selection != SELECT_ALL_NEGATIVE)
+	{
+		// hyperresolution needs every negative literal selected
+		std::cout << EXEC_NAME << " error: option -y cannot be used with " <<
+			"-n " << g_literal_selection << std::endl;
+		return 0;
+	}
+	if(support_file_name != "" && g_set_of_support == SOS_DISABLED)
+	{
+		// the chosen clauses only matter to the set of support strategy
+		std::cout << EXEC_NAME << " error: option -T requires a set of " <<
+			"support strategy (-e 1 or -e 2)" << std::endl;
+		return 0;
+	}
+	if(g_symmetry_length != SYMMETRY_DISABLED && !g_forward_subsumption)
+	{
+		// the images of a clause are only discarded by forward subsumption
+		std::cout << EXEC_NAME << " error: option -g requires forward " <<
+			"subsumption (-f 1)" << std::endl;
+		return 0;
+	}
 
 	// begin the timer
 	clock_t begin = clock();
 
+	if(g_hyperresolution)
+	{
+		/* the nucleus of a hyperresolution step is resolved upon all of its
+		   negative literals at once */
+		g_literal_selection = SELECT_ALL_NEGATIVE;
+	}
+
 	if(ordering_file_name != "")
 	{
 		/* a literal ordering has been defined so we will decrement literal
@@ -156,6 +328,12 @@ int main(int argc, char** argv)
 		Literal::next_literal_rank = 1;
 	}
 
+	if(support_file_name != "" && !parseSupportFile(support_file_name))
+	{
+		cleanup();
+		return 0;
+	}
+
 	// parse the input file
 	std::list<Clause*>* parsed_clauses = parseInputFile(input_file_name);
 
@@ -175,6 +353,55 @@ int main(int argc, char** argv)
 				l->rank -= sub;
 			});
 	}
+	else if(g_literal_ordering != ORDER_INPUT &&
+		g_literal_ordering != ORDER_TUNED)
+	{
+		// rank the literals by the selected generator
+		literal_ordering::applyOrdering(literal_ordering::generateOrdering(
+			parsed_clauses, g_literal_ordering), parsed_clauses);
+	}
+
+	// the names of split components to be ranked just below each literal
+	std::map<Literal*, std::vector<Literal*>> split_names;
+	if(g_split_length != SPLIT_DISABLED)
+	{
+		/* split the long clauses once the ranks of the parsed literals are
+		   final, the names are ranked just below their components */
+		splitLongClauses(parsed_clauses, split_names);
+	}
+
+	if(g_literal_masks)
+	{
+		/* build the bitmasks of the parsed clauses, which are exact if every
+		   rank fits into a bitmask and are rebuilt if the literals are ranked
+		   again */
+		LiteralList::use_literal_masks = true;
+		LiteralList::exact_literal_masks =
+			g_literals->size() <= MAX_MASKED_LITERALS;
+		std::for_each(parsed_clauses->begin(), parsed_clauses->end(),
+			[](Clause* c)
+			{
+				c->calculateLiteralMasks();
+			});
+	}
+
+	if(g_literal_ordering == ORDER_TUNED && ordering_file_name == "")
+	{
+		/* rank the literals by the generator making the most progress, the
+		   probing runs start from the split clauses with their bitmasks */
+		literal_ordering::applyOrdering(tuneOrdering(parsed_clauses,
+			split_names, tuned_generator), parsed_clauses);
+	}
+
+	if(ordering_output_file_name != "" &&
+		!literal_ordering::writeOrderingFile(ordering_output_file_name))
+	{
+		// the ordering could not be written so clean up and exit
+		g_archive->splice(g_archive->end(), *parsed_clauses);
+		delete parsed_clauses;
+		cleanup();
+		return 0;
+	}
 
 	if(!parsed_clauses->empty())
 	{
@@ -245,7 +472,30 @@ int main(int argc, char** argv)
 		return 0;
 	}
 
-	resolution(parsed_clauses);
+	// schedulers measuring backward subsumption against each index
+	SimplificationScheduler saturated_scheduler(
+		"Saturated index backward subsumption");
+	SimplificationScheduler non_saturated_scheduler(
+		"Non-saturated index backward subsumption");
+	// queues of the clauses awaiting selection by weight and by age
+	ClauseSelector clause_selector(g_weight_function, g_weight_ratio);
+	// activities of the literals, used by the literal activity heuristic
+	ActivitySelector activity_selector(g_literals->size(),
+		g_weight_ratio);
+	if(g_heuristic == LITERAL_ACTIVITY)
+	{
+		g_activity_selector = &activity_selector;
+	}
+	// distances of the literals from the initial clauses
+	GoalDistanceSelector goal_selector(g_literals->size());
+	// symmetries of the input clauses
+	SymmetryDetector symmetry_detector(g_symmetry_length);
+	resolution(parsed_clauses,
+		g_adaptive_scheduling ? &saturated_scheduler : nullptr,
+		g_adaptive_scheduling ? &non_saturated_scheduler : nullptr,
+		g_heuristic == AGE_WEIGHT ? &clause_selector : nullptr,
+		g_heuristic == GOAL_DISTANCE ? &goal_selector : nullptr,
+		g_symmetry_length != SYMMETRY_DISABLED ? &symmetry_detector : nullptr);
 
 	if(g_display_extra_inference_information)
 	{
@@ -253,6 +503,13 @@ int main(int argc, char** argv)
 			std::endl;
 		std::cout << "Applications of GRES1: " << g_inference_count_gres1 <<
 			std::endl;
+		if(g_hyperresolution)
+		{
+			std::cout << "Applications of HRES: " << g_inference_count_hres <<
+				std::endl;
+			std::cout << "Partial hyperresolvents subsumed: " <<
+				g_hres_subsumed_partials << std::endl;
+		}
 		std::cout << "Applications of CRES1: " << g_inference_count_cres1 <<
 			std::endl;
 		std::cout << "Applications of CRES2: " << g_inference_count_cres2 <<
@@ -265,18 +522,81 @@ int main(int argc, char** argv)
 			std::endl;
 		std::cout << "Tautologies derived: " << g_inference_count_tautology <<
 			std::endl;
+		std::cout << "Coalition merges rejected by vector shape: " <<
+			g_coalition_merges_skipped << std::endl;
 	}
 	std::cout << "Total inferences: " << (g_inference_count_ires1 +
-		g_inference_count_gres1 + g_inference_count_cres1 +
-		g_inference_count_cres2 + g_inference_count_cres3 +
-		g_inference_count_cres4 + g_inference_count_cres5 +
+		g_inference_count_gres1 + g_inference_count_hres +
+		g_inference_count_cres1 + g_inference_count_cres2 +
+		g_inference_count_cres3 + g_inference_count_cres4 +
+		g_inference_count_cres5 +
 		g_inference_count_tautology) << std::endl;
+	if(g_verbosity >= V_MAXIMAL || g_display_extra_inference_information)
+	{
+		std::cout << "Duplicate resolvents discarded in batch: " <<
+			g_batch_duplicate_resolvents << std::endl;
+		std::cout << "Duplicate resolvents discarded as recently derived: " <<
+			g_recent_duplicate_resolvents << std::endl;
+	}
 	std::cout << "Forward subsumed clauses: " << g_forward_subsumed_count <<
 		std::endl;
+	if(g_forward_subsumption && g_loop_style == DISCOUNT_LOOP)
+	{
+		std::cout << "Given clauses subsumed when selected: " <<
+			g_given_subsumed_count << std::endl;
+	}
+	if(g_forward_subsumption && (g_verbosity >= V_MAXIMAL ||
+		g_display_extra_inference_information))
+	{
+		std::cout << "Subsumer cache hits: " << g_subsumer_cache_hits <<
+			std::endl;
+		std::cout << "Subsumer cache misses: " << g_subsumer_cache_misses <<
+			std::endl;
+	}
 	if(g_backward_subsumption)
 	{
 		std::cout << "Backward subsumed clauses: " << g_backward_subsumed_count <<
 			std::endl;
+		std::cout << "Backward subsumption candidates checked: " <<
+			g_backward_subsumption_candidates << std::endl;
+		if(g_adaptive_scheduling)
+		{
+			saturated_scheduler.displayStatistics();
+			if(!g_unified_index)
+			{
+				non_saturated_scheduler.displayStatistics();
+			}
+		}
+	}
+	if(g_subsumption_resolution)
+	{
+		std::cout << "Forward subsumption resolutions: " <<
+			g_forward_subsumption_resolutions << std::endl;
+		std::cout << "Backward subsumption resolutions: " <<
+			g_backward_subsumption_resolutions << std::endl;
+	}
+	if(g_heuristic == AGE_WEIGHT)
+	{
+		clause_selector.displayStatistics();
+	}
+	else if(g_heuristic == LITERAL_ACTIVITY)
+	{
+		activity_selector.displayStatistics();
+	}
+	else if(g_heuristic == GOAL_DISTANCE)
+	{
+		goal_selector.displayStatistics();
+	}
+	if(g_symmetry_length != SYMMETRY_DISABLED)
+	{
+		symmetry_detector.displayStatistics();
+	}
+	if(g_set_of_support != SOS_DISABLED)
+	{
+		std::cout << "Resolution partners skipped by set of support: " <<
+			g_sos_skipped_partners << std::endl;
+		std::cout << "Unsupported clauses selected again: " <<
+			g_sos_reopened_clauses << std::endl;
 	}
 	std::cout << "Rewritten clauses: " << g_rewrite_count << std::endl;
 	if(g_purity_deletion)
@@ -284,6 +604,16 @@ int main(int argc, char** argv)
 		std::cout << "Clauses eliminated in purity deletion: " <<
 			g_purity_deletion_clauses_eliminated << std::endl;
 	}
+	if(g_literal_ordering == ORDER_TUNED && ordering_file_name == "")
+	{
+		std::cout << "Literal ordering generator chosen by tuning: " <<
+			tuned_generator << std::endl;
+	}
+	if(g_split_length != SPLIT_DISABLED)
+	{
+		std::cout << "Clauses split: " << g_split_clauses << std::endl;
+		std::cout << "Split component names: " << g_split_names << std::endl;
+	}
 	if(g_unit_propagation)
 	{
 		std::cout << "Clauses eliminated in unit propagation: " <<
@@ -307,9 +637,16 @@ int main(int argc, char** argv)
 	resolution
 
 	Exhaustively applies the inference rules to the given list of clauses
-	until satisfiability is determined.
+	until satisfiability is determined. Backward subsumption against the
+	saturated and non-saturated indexes is throttled by the given schedulers
+	if they are not null. Clauses are selected using the given clause
+	selector or goal distance selector if it is not null.
 --------------------------------------------------------------------------*/
-void resolution(std::list<Clause*>* parsed_clauses)
+void resolution(std::list<Clause*>* parsed_clauses,
+	SimplificationScheduler* saturated_scheduler,
+	SimplificationScheduler* non_saturated_scheduler,
+	ClauseSelector* clause_selector, GoalDistanceSelector* goal_selector,
+	SymmetryDetector* symmetry_detector, literal_ordering::ProbeResult* probe)
 {
 	/* Define the first level of the indexes to have a size equal to the
 	   number of clause types.
@@ -320,20 +657,34 @@ void resolution(std::list<Clause*>* parsed_clauses)
 
 	   The final level has a size equal to |parsed literals| + 1, as each list
 	   of literals can contain at most |parsed literals| literals without being
-	   tautological. In addition a contradiction has 0 literals. */
-	ClauseIndex temp_index(NUM_FEATURES, NUM_CLAUSE_TYPES,
-		g_literals->size() + 1, g_literals->size() + 1);
+	   tautological. In addition a contradiction has 0 literals.
+
+	   If a single index is used then the non-saturated index is the saturated
+	   index, and clauses are tagged as saturated when they are selected. */
 	ClauseIndex saturated_index(NUM_FEATURES, NUM_CLAUSE_TYPES,
 		g_literals->size() + 1, g_literals->size() + 1);
-	ClauseIndex non_saturated_index(NUM_FEATURES, NUM_CLAUSE_TYPES,
-		g_literals->size() + 1, g_literals->size() + 1);
+	ClauseIndex* passive_index = g_unified_index ? nullptr :
+		new ClauseIndex(NUM_FEATURES, NUM_CLAUSE_TYPES,
+			g_literals->size() + 1, g_literals->size() + 1);
+	ClauseIndex& non_saturated_index = g_unified_index ? saturated_index :
+		*passive_index;
+	/* the clauses awaiting backward subsumption and the number of given
+	   clauses they were derived from */
+	std::list<Clause*> backward_batch;
+	int batch_iterations = 0;
+	/* the Otter-style loop simplifies the resolvents against the passive
+	   clauses, the DISCOUNT-style loop instead checks each passive clause
+	   against the saturated clauses again when it is selected */
+	bool simplify_passive = !g_unified_index && g_loop_style == OTTER_LOOP;
+	bool recheck_given = g_forward_subsumption && !g_unified_index &&
+		g_loop_style == DISCOUNT_LOOP;
 
 	if(g_verbosity >= V_MAXIMAL)
 	{
 		displayTitle("Initial Self Subsumption");
 	}
 	// initial self-subsumption
-	parsed_clauses = clause_list::initialSelfSubsumption(parsed_clauses, temp_index);
+	parsed_clauses = clause_list::initialSelfSubsumption(parsed_clauses);
 	if(g_purity_deletion)
 	{
 		// purity deletion
@@ -357,6 +708,7 @@ void resolution(std::list<Clause*>* parsed_clauses)
 		/* a contradiction was derived from unit propagation so add this to the
 		   saturated index and delete the other parsed clauses */
 		saturated_index.addToIndex(g_contradiction);
+		saturated_index.markSaturated(g_contradiction);
 		std::for_each(parsed_clauses->begin(), parsed_clauses->end(),
 			[&](Clause* parsed_clause)
 			{
@@ -365,6 +717,54 @@ void resolution(std::list<Clause*>* parsed_clauses)
 	}
 	else
 	{
+		if(g_literal_selection == SELECT_FEWEST_OCCURRENCES)
+		{
+			/* count the occurrences of each literal, a literal in the
+			   conjunction of a coalition clause occurs negated */
+			std::for_each(parsed_clauses->begin(), parsed_clauses->end(),
+				[](Clause* c)
+				{
+					if(c->getRight()->size() > 0)
+					{
+						std::for_each(c->getRight()->getList()->begin(),
+							c->getRight()->getList()->end(), [](Literal* l)
+							{
+								l->occurrences++;
+							});
+					}
+					if(c->getLeft()->size() > 0)
+					{
+						std::for_each(c->getLeft()->getList()->begin(),
+							c->getLeft()->getList()->end(), [](Literal* l)
+							{
+								l->complementary_literal->occurrences++;
+							});
+					}
+				});
+		}
+		if(g_set_of_support != SOS_DISABLED)
+		{
+			/* the set of support holds the initial clauses, optionally the
+			   coalition clauses and the chosen input clauses, and every clause
+			   derived from them */
+			std::for_each(parsed_clauses->begin(), parsed_clauses->end(),
+				[&](Clause* c)
+				{
+					c->setSupported(c->getClauseType() == ClauseType::INITIAL ||
+						(g_coalition_support &&
+						c->getClauseType() != ClauseType::UNIVERSAL) ||
+						g_support_clauses->count(c->getIdentifier()) != 0);
+				});
+		}
+		if(symmetry_detector != nullptr)
+		{
+			// symmetry detection
+			if(g_verbosity >= V_MAXIMAL)
+			{
+				displayTitle("Symmetry Detection");
+			}
+			symmetry_detector->detectSymmetries(parsed_clauses);
+		}
 		// add all the parsed clauses to the non-saturated index
 		std::for_each(parsed_clauses->begin(), parsed_clauses->end(),
 			[&](Clause* c)
@@ -378,61 +778,59 @@ void resolution(std::list<Clause*>* parsed_clauses)
 		}
 
 		Clause* given;
-		if(g_heuristic == GET_NEXT)
-		{
-			// comparator to compare clauses
-			auto comparator =
-				[](const Clause* this_clause, const Clause* that_clause)
-				{
-					return this_clause->getIdentifier()
-						< that_clause->getIdentifier();
-				};
-			// sets for clause selection
-			std::set<Clause*, std::function<bool (Clause*, Clause*)>>
-				initial_set(comparator);
-			std::set<Clause*, std::function<bool (Clause*, Clause*)>>
-				universal_set(comparator);
-			std::set<Clause*, std::function<bool (Clause*, Clause*)>>
-				coalition_set(comparator);
-			// add all the clauses to the corresponding set
-			std::for_each(parsed_clauses->begin(), parsed_clauses->end(),
-				[&](Clause* c)
+		/* with the complete set of support strategy, once no passive clauses
+		   remain the unsupported clauses are made supported and selected
+		   again, so that they are resolved with each other. Returns true if
+		   any clauses were selected again, after passing each to the given
+		   function */
+		auto reopen_unsupported =
+			[&](std::function<void (Clause*)> queue_clause)
+			{
+				if(g_set_of_support != SOS_COMPLETE)
 				{
-					if(g_heuristic == GET_NEXT)
+					return false;
+				}
+				std::list<Clause*>* unsupported_clauses =
+					saturated_index.getUnsupportedClauses();
+				bool reopened = !unsupported_clauses->empty();
+				std::for_each(unsupported_clauses->begin(),
+					unsupported_clauses->end(),
+					[&](Clause* c)
 					{
-						if(c->getClauseType() == ClauseType::UNIVERSAL)
-						{
-							universal_set.insert(c);
-						}
-						else if(c->getClauseType() == ClauseType::INITIAL)
+						c->setSupported(true);
+						saturated_index.markUnsaturated(c);
+						if(!g_unified_index)
 						{
-							initial_set.insert(c);
+							saturated_index.removeFromIndex(c);
+							non_saturated_index.addToIndex(c);
 						}
-						else
-						{
-							coalition_set.insert(c);
-						}
-					}
-				});
-			while(non_saturated_index.getNumClauses() > 0)
+						queue_clause(c);
+						g_sos_reopened_clauses++;
+					});
+				delete unsupported_clauses;
+				return reopened;
+			};
+		/* the number of passive clauses removed by backward simplification
+		   that are still in the selection queues */
+		unsigned int dead_queued = 0;
+		/* resolves the given clause with the saturated clauses, simplifies
+		   the resolvents and adds the survivors to the non-saturated index,
+		   passing each to the given function. Returns true if the search
+		   stops, either because a contradiction was derived or because a
+		   probing run has used its budget */
+		auto process_given =
+			[&](Clause* given, std::function<void (Clause*)> queue_clause)
 			{
-				if(!universal_set.empty())
+				if(recheck_given && givenClauseSubsumed(given, saturated_index,
+					non_saturated_index))
 				{
-					auto it = universal_set.begin();
-					given = *it;
-					universal_set.erase(it);
+					return false;
 				}
-				else if(!coalition_set.empty())
+				if(probe != nullptr &&
+					++probe->given_clauses > TUNE_PROBE_GIVEN_CLAUSES)
 				{
-					auto it = coalition_set.begin();
-					given = *it;
-					coalition_set.erase(it);
-				}
-				else
-				{
-					auto it = initial_set.begin();
-					given = *it;
-					initial_set.erase(it);
+					// the probing run has used its budget
+					return true;
 				}
 				if(g_verbosity >= V_MAXIMAL)
 				{
@@ -441,28 +839,97 @@ void resolution(std::list<Clause*>* parsed_clauses)
 					given->displayClause();
 				}
 				// move the clause from non saturated to saturated
-				non_saturated_index.removeFromIndex(given);
-				saturated_index.addToIndex(given);
+				if(!g_unified_index)
+				{
+					non_saturated_index.removeFromIndex(given);
+					saturated_index.addToIndex(given);
+				}
+				saturated_index.markSaturated(given);
 				// resolve the clause with the saturated index
 				std::list<Clause*>* resolved_list =
 					saturated_index.resolve(given);
+				if(symmetry_detector != nullptr)
+				{
+					// the symmetric images of the clause need not be resolved
+					symmetry_detector->addImages(given, resolved_list);
+				}
+				if(g_activity_selector != nullptr)
+				{
+					// bump the literals resolved upon, then age all activities
+					std::for_each(resolved_list->begin(), resolved_list->end(),
+						[](Clause* c)
+						{
+							if(c->getJustification()->resolved_literal != nullptr)
+							{
+								g_activity_selector->bumpLiteral(
+									c->getJustification()->resolved_literal);
+							}
+						});
+					g_activity_selector->decayActivities();
+				}
 				// self subsumption
-				resolved_list = clause_list::selfSubsumption(resolved_list, temp_index);
+				resolved_list = clause_list::selfSubsumption(resolved_list);
 				if(g_forward_subsumption)
 				{
 					// forward subsumption
-					resolved_list = clause_list::subsumption(clause_list::subsumption(
-								resolved_list, saturated_index),
-								non_saturated_index);
+					resolved_list = clause_list::subsumption(resolved_list,
+						saturated_index);
+					if(simplify_passive)
+					{
+						resolved_list = clause_list::subsumption(resolved_list,
+							non_saturated_index);
+					}
+				}
+				// only the surviving resolvents are given identifiers
+				Clause::assignIdentifiers(resolved_list);
+				if(g_subsumption_resolution)
+				{
+					// forward subsumption resolution
+					resolved_list = clause_list::subsumptionResolution(
+						resolved_list, saturated_index);
+					if(simplify_passive)
+					{
+						resolved_list = clause_list::subsumptionResolution(
+							resolved_list, non_saturated_index);
+					}
 				}
+				/* the passive clauses removed by backward subsumption and
+				   backward subsumption resolution are left in the queues as
+				   dead clauses */
+				int num_passive = non_saturated_index.getNumPassiveClauses();
 				if(g_backward_subsumption)
 				{
-					// backward subsumption
-					clause_list::backwardSubsumptionGetNext(resolved_list,
-						saturated_index, &initial_set, &universal_set, &coalition_set);
-					clause_list::backwardSubsumptionGetNext(resolved_list,
-						non_saturated_index, &initial_set, &universal_set, &coalition_set);
+					/* backward subsumption, applied once the batch holds the
+					   resolvents of enough given clauses */
+					backward_batch.insert(backward_batch.end(),
+						resolved_list->begin(), resolved_list->end());
+					if(++batch_iterations >= g_backward_batch_size ||
+						backward_batch.size() >= BACKWARD_BATCH_MAX_CLAUSES)
+					{
+						scheduledBackwardSubsumption(&backward_batch,
+							saturated_index, saturated_scheduler);
+						if(simplify_passive)
+						{
+							scheduledBackwardSubsumption(&backward_batch,
+								non_saturated_index, non_saturated_scheduler);
+						}
+						backward_batch.clear();
+						batch_iterations = 0;
+					}
+				}
+				if(g_subsumption_resolution)
+				{
+					// backward subsumption resolution
+					clause_list::backwardSubsumptionResolution(resolved_list,
+						saturated_index);
+					if(simplify_passive)
+					{
+						clause_list::backwardSubsumptionResolution(resolved_list,
+							non_saturated_index);
+					}
 				}
+				dead_queued += num_passive -
+					non_saturated_index.getNumPassiveClauses();
 				if(g_verbosity >= V_MAXIMAL)
 				{
 					// display the simplified non-tautological resolvents
@@ -478,98 +945,161 @@ void resolution(std::list<Clause*>* parsed_clauses)
 						});
 					std::cout << DIVIDER_1;
 				}
+				if(probe != nullptr)
+				{
+					std::for_each(resolved_list->begin(), resolved_list->end(),
+						[&](Clause* c)
+						{
+							probe->smallest_resolvent =
+								std::min(probe->smallest_resolvent, c->size());
+						});
+				}
 				// add the resolvents to the non saturated index
 				std::for_each(resolved_list->begin(), resolved_list->end(),
 					[&](Clause* c)
 					{
 						non_saturated_index.addToIndex(c);
-						if(c->getClauseType() == ClauseType::UNIVERSAL)
-						{
-							universal_set.insert(c);
-						}
-						else if(c->getClauseType() == ClauseType::INITIAL)
-						{
-							initial_set.insert(c);
-						}
-						else
-						{
-							coalition_set.insert(c);
-						}
+						queue_clause(c);
 					});
 				if(g_contradiction != nullptr)
 				{
 					// we have derived a contradiction so we can stop
+					g_contradiction->assignIdentifier();
 					saturated_index.addToIndex(g_contradiction);
+					saturated_index.markSaturated(g_contradiction);
 					delete resolved_list;
-					break;
+					return true;
 				}
 				delete resolved_list;
-			}
-		}
-		else if(g_heuristic == GET_NEXT_SMALLEST)
+				return false;
+			};
+		if(g_heuristic == GET_NEXT)
 		{
-			while((given = non_saturated_index.getNextSmallestClause()) != nullptr)
+			// queues for clause selection, ordered by clause identifier
+			ClauseQueue initial_queue;
+			ClauseQueue universal_queue;
+			ClauseQueue coalition_queue;
+			// adds a clause to the corresponding queue
+			auto queue_clause =
+				[&](Clause* c)
+				{
+					if(c->getClauseType() == ClauseType::UNIVERSAL)
+					{
+						universal_queue.push(c);
+					}
+					else if(c->getClauseType() == ClauseType::INITIAL)
+					{
+						initial_queue.push(c);
+					}
+					else
+					{
+						coalition_queue.push(c);
+					}
+				};
+			std::for_each(parsed_clauses->begin(), parsed_clauses->end(),
+				queue_clause);
+			while(non_saturated_index.getNumPassiveClauses() > 0 ||
+				reopen_unsupported(queue_clause))
 			{
-				if(g_verbosity >= V_MAXIMAL)
+				if(!universal_queue.empty())
 				{
-					std::cout << DIVIDER_1;
-					std::cout << "Resolving clause:\n";
-					given->displayClause();
+					given = universal_queue.pop();
 				}
-				// move the clause from non saturated to saturated
-				non_saturated_index.removeFromIndex(given);
-				saturated_index.addToIndex(given);
-				// resolve the clause with the saturated index
-				std::list<Clause*>* resolved_list =
-					saturated_index.resolve(given);
-				// self subsumption
-				resolved_list = clause_list::selfSubsumption(resolved_list, temp_index);
-				if(g_forward_subsumption)
+				else if(!coalition_queue.empty())
 				{
-					// forward subsumption
-					resolved_list = clause_list::subsumption(clause_list::subsumption(
-								resolved_list, saturated_index),
-								non_saturated_index);
+					given = coalition_queue.pop();
 				}
-				if(g_backward_subsumption)
+				else
 				{
-					// backward subsumption
-					clause_list::backwardSubsumption(resolved_list, saturated_index);
-					clause_list::backwardSubsumption(resolved_list, non_saturated_index);
+					given = initial_queue.pop();
 				}
-				if(g_verbosity >= V_MAXIMAL)
+				if(given->isDead())
 				{
-					// display the simplified non-tautological resolvents
-					std::cout << "Resolvents:\n";
-					if(resolved_list->size() == 0)
+					// the clause was backward subsumed after it was queued
+					dead_queued--;
+					continue;
+				}
+				if(process_given(given, queue_clause))
+				{
+					break;
+				}
+				if(dead_queued * 100 > (initial_queue.size() +
+					universal_queue.size() + coalition_queue.size()) *
+					DEAD_CLAUSE_COMPACTION_PERCENT)
+				{
+					// purge the dead clauses from the queues
+					initial_queue.removeDead();
+					universal_queue.removeDead();
+					coalition_queue.removeDead();
+					dead_queued = 0;
+				}
+			}
+		}
+		else
+		{
+			/* select the clauses by weight and age, by activity, by goal
+			   distance or by size */
+			auto get_next =
+				[&]()
+				{
+					if(clause_selector != nullptr)
 					{
-						std::cout << "none\n";
+						return clause_selector->getNext();
 					}
-					std::for_each(resolved_list->begin(), resolved_list->end(),
-						[&](Clause* c)
-						{
-							c->displayClause();
-						});
-					std::cout << DIVIDER_1;
-				}
-				// add the resolvents to the non saturated index
-				std::for_each(resolved_list->begin(), resolved_list->end(),
-					[&](Clause* c)
+					if(g_activity_selector != nullptr)
 					{
-						non_saturated_index.addToIndex(c);
-					});
-				if(g_contradiction != nullptr)
+						return g_activity_selector->getNext();
+					}
+					if(goal_selector != nullptr)
+					{
+						return goal_selector->getNext();
+					}
+					return non_saturated_index.getNextSmallestClause();
+				};
+			// queue a clause with the selector in use, if any
+			auto add_to_selector =
+				[&](Clause* c)
+				{
+					if(clause_selector != nullptr)
+					{
+						clause_selector->addClause(c);
+					}
+					else if(g_activity_selector != nullptr)
+					{
+						g_activity_selector->addClause(c);
+					}
+					else if(goal_selector != nullptr)
+					{
+						goal_selector->addClause(c);
+					}
+				};
+			std::for_each(parsed_clauses->begin(), parsed_clauses->end(),
+				add_to_selector);
+			while((given = get_next()) != nullptr ||
+				(reopen_unsupported(add_to_selector) &&
+				(given = get_next()) != nullptr))
+			{
+				if(process_given(given, add_to_selector))
 				{
-					// we have derived a contradiction so we can stop
-					saturated_index.addToIndex(g_contradiction);
-					delete resolved_list;
 					break;
 				}
-				delete resolved_list;
 			}
 		}
 	}
 
+	if(probe != nullptr)
+	{
+		// a probing run only measures its progress
+		probe->finished = g_contradiction != nullptr ||
+			probe->given_clauses <= TUNE_PROBE_GIVEN_CLAUSES;
+		probe->given_clauses = std::min(probe->given_clauses,
+			TUNE_PROBE_GIVEN_CLAUSES);
+		probe->passive_clauses = non_saturated_index.getNumPassiveClauses();
+		delete passive_index;
+		delete parsed_clauses;
+		return;
+	}
+
 	if(g_verbosity >= V_DEFAULT)
 	{
 		// display the archived and saturated clauses
@@ -591,14 +1121,255 @@ void resolution(std::list<Clause*>* parsed_clauses)
 		}
 		std::cout << "Unsatisfiable\n";
 	}
+	else if(g_set_of_support == SOS_INCOMPLETE && g_sos_skipped_partners > 0)
+	{
+		// inferences were suppressed so the clauses were not saturated
+		std::cout << "Unknown\n";
+	}
 	else
 	{
 		std::cout << "Satisfiable\n";
 	}
 
+	delete passive_index;
 	delete parsed_clauses;
 }
 
+/*--------------------------------------------------------------------------
+	tuneOrdering
+
+	Runs resolution on copies of the given clauses under the ordering of each
+	literal ordering generator in turn, stopping each run after
+	TUNE_PROBE_GIVEN_CLAUSES given clauses, and returns the ordering of the run
+	that made the most progress, setting the given generator to the one that
+	produced it. The given names of split components stay just below their
+	components in every ordering, and the copy of a clause in the set of
+	support is in the set of support for its run. The clauses derived by the
+	runs and their statistics are discarded.
+--------------------------------------------------------------------------*/
+std::vector<Literal*> tuneOrdering(std::list<Clause*>* parsed_clauses,
+	const std::map<Literal*, std::vector<Literal*>>& split_names,
+	int& best_generator)
+{
+	// the candidates are generated from the order of appearance
+	std::vector<std::vector<Literal*>> candidates;
+	for(int generator = ORDER_INPUT; generator <= ORDER_CUTHILL_MCKEE;
+		generator++)
+	{
+		candidates.push_back(placeSplitNames(
+			literal_ordering::generateOrdering(parsed_clauses, generator),
+			split_names));
+	}
+	// the state that the probing runs must leave unchanged
+	std::list<Clause*>* archive = g_archive;
+	int next_identifier = Clause::getNextIdentifier();
+	int rewrite_count = g_rewrite_count;
+	int verbosity = g_verbosity;
+	if(verbosity >= V_MAXIMAL)
+	{
+		displayTitle("Literal Ordering Tuning");
+	}
+	g_verbosity = V_MINIMAL;
+	literal_ordering::ProbeResult best;
+	best_generator = ORDER_INPUT;
+	for(int generator = ORDER_INPUT; generator <= ORDER_CUTHILL_MCKEE;
+		generator++)
+	{
+		literal_ordering::applyOrdering(candidates[generator], parsed_clauses);
+		/* copy the clauses, whose literals are now sorted by the new ranks,
+		   and the membership of the set of support */
+		std::list<Clause*>* probe_clauses = new std::list<Clause*>();
+		std::vector<int> probe_support;
+		std::for_each(parsed_clauses->begin(), parsed_clauses->end(),
+			[&](Clause* c)
+			{
+				Justification* j = c->getJustification();
+				Clause* copy = new Clause(
+					new LiteralList(*c->getLeft()),
+					new std::list<int>(*c->getAgents()),
+					new LiteralList(*c->getRight()), c->getClauseType(),
+					j == nullptr ? nullptr : new Justification(
+						j->input_clause_1, j->input_clause_2,
+						j->resolved_literal, j->inference_rule),
+					c->getCoalitionVector() == nullptr ? nullptr :
+						new std::vector<int>(*c->getCoalitionVector()));
+				if(g_support_clauses->count(c->getIdentifier()) != 0)
+				{
+					probe_support.push_back(copy->getIdentifier());
+				}
+				probe_clauses->push_back(copy);
+			});
+		g_support_clauses->insert(probe_support.begin(), probe_support.end());
+		g_archive = new std::list<Clause*>();
+		SimplificationScheduler saturated_scheduler(
+			"Saturated index backward subsumption");
+		SimplificationScheduler non_saturated_scheduler(
+			"Non-saturated index backward subsumption");
+		ClauseSelector clause_selector(g_weight_function, g_weight_ratio);
+		ActivitySelector activity_selector(g_literals->size(),
+			g_weight_ratio);
+		if(g_heuristic == LITERAL_ACTIVITY)
+		{
+			g_activity_selector = &activity_selector;
+		}
+		GoalDistanceSelector goal_selector(g_literals->size());
+		SymmetryDetector symmetry_detector(g_symmetry_length);
+		literal_ordering::ProbeResult result;
+		resolution(probe_clauses,
+			g_adaptive_scheduling ? &saturated_scheduler : nullptr,
+			g_adaptive_scheduling ? &non_saturated_scheduler : nullptr,
+			g_heuristic == AGE_WEIGHT ? &clause_selector : nullptr,
+			g_heuristic == GOAL_DISTANCE ? &goal_selector : nullptr,
+			g_symmetry_length != SYMMETRY_DISABLED ? &symmetry_detector :
+				nullptr, &result);
+		result.inferences = g_inference_count_ires1 + g_inference_count_gres1 +
+			g_inference_count_hres + g_inference_count_cres1 +
+			g_inference_count_cres2 + g_inference_count_cres3 +
+			g_inference_count_cres4 + g_inference_count_cres5 +
+			g_inference_count_tautology;
+		result.subsumed_resolvents = g_forward_subsumed_count;
+		if(verbosity >= V_MAXIMAL)
+		{
+			std::cout << "Literal ordering generator " << generator << ": " <<
+				(result.finished ? "finished" : "stopped") << " after " <<
+				result.given_clauses << " given clauses, smallest resolvent " <<
+				result.smallest_resolvent << ", passive clauses " <<
+				result.passive_clauses << ", forward subsumed " <<
+				result.subsumed_resolvents << " of " << result.inferences <<
+				" inferences\n";
+		}
+		if(generator == ORDER_INPUT || result < best)
+		{
+			best = result;
+			best_generator = generator;
+		}
+		// discard the clauses and statistics of the run
+		std::for_each(g_archive->begin(), g_archive->end(), [](Clause* c)
+			{
+				delete c;
+			});
+		delete g_archive;
+		g_archive = archive;
+		// the identifiers of the copies are used again by the next run
+		std::for_each(probe_support.begin(), probe_support.end(),
+			[](int identifier)
+			{
+				g_support_clauses->erase(identifier);
+			});
+		g_contradiction = nullptr;
+		g_activity_selector = nullptr;
+		std::for_each(g_literals->begin(), g_literals->end(), [](Literal* l)
+			{
+				l->occurrences = 0;
+			});
+		resetStatistics();
+	}
+	Clause::setNextIdentifier(next_identifier);
+	g_rewrite_count = rewrite_count;
+	g_verbosity = verbosity;
+	return candidates[best_generator];
+}
+
+/*--------------------------------------------------------------------------
+	resetStatistics
+
+	Resets the statistics counted by the inference and simplification rules.
+--------------------------------------------------------------------------*/
+void resetStatistics()
+{
+	g_inference_count_tautology = 0;
+	g_inference_count_ires1 = 0;
+	g_inference_count_gres1 = 0;
+	g_inference_count_hres = 0;
+	g_hres_subsumed_partials = 0;
+	g_inference_count_cres1 = 0;
+	g_inference_count_cres2 = 0;
+	g_inference_count_cres3 = 0;
+	g_inference_count_cres4 = 0;
+	g_inference_count_cres5 = 0;
+	g_backward_subsumed_count = 0;
+	g_forward_subsumed_count = 0;
+	g_given_subsumed_count = 0;
+	g_backward_subsumption_candidates = 0;
+	g_forward_subsumption_resolutions = 0;
+	g_backward_subsumption_resolutions = 0;
+	g_sos_skipped_partners = 0;
+	g_sos_reopened_clauses = 0;
+	g_coalition_merges_skipped = 0;
+	g_subsumer_cache_hits = 0;
+	g_subsumer_cache_misses = 0;
+	g_batch_duplicate_resolvents = 0;
+	g_recent_duplicate_resolvents = 0;
+	g_rewrite_count = 0;
+	g_unit_propagation_clauses_removed = 0;
+	g_unit_propagation_literals_removed = 0;
+	g_purity_deletion_clauses_eliminated = 0;
+}
+
+/*--------------------------------------------------------------------------
+	scheduledBackwardSubsumption
+
+	Applies backward subsumption against the given index using the clauses in
+	the given list that are selected by the given scheduler, or using all of
+	the clauses if there is no scheduler. The clauses are applied as a single
+	batch if backward subsumption is batched across given clauses.
+--------------------------------------------------------------------------*/
+void scheduledBackwardSubsumption(std::list<Clause*>* clause_list,
+	ClauseIndex& clause_index, SimplificationScheduler* scheduler)
+{
+	// clauses from earlier given clauses are already stored in the index
+	auto apply = g_backward_batch_size > 1 ?
+		clause_list::batchBackwardSubsumption :
+		clause_list::backwardSubsumption;
+	if(scheduler == nullptr)
+	{
+		apply(clause_list, clause_index);
+		return;
+	}
+	long candidates = g_backward_subsumption_candidates;
+	int removed = g_backward_subsumed_count;
+	std::list<Clause*>* selected_clauses = scheduler->selectClauses(clause_list);
+	apply(selected_clauses, clause_index);
+	scheduler->recordApplication(g_backward_subsumption_candidates - candidates,
+		g_backward_subsumed_count - removed);
+	delete selected_clauses;
+}
+
+/*--------------------------------------------------------------------------
+	givenClauseSubsumed
+
+	Returns true if the given clause, just selected from the non-saturated
+	index, is subsumed by a clause in the saturated index. A subsumed clause
+	is removed from the non-saturated index and archived.
+--------------------------------------------------------------------------*/
+bool givenClauseSubsumed(Clause* given, ClauseIndex& saturated_index,
+	ClauseIndex& non_saturated_index)
+{
+	Clause* subsumer = clause_list::findSubsumer(given, saturated_index);
+	if(subsumer == nullptr)
+	{
+		return false;
+	}
+	if(g_verbosity >= V_MAXIMAL)
+	{
+		std::cout << DIVIDER_2;
+		std::cout << "Given clause subsumption:\n";
+		given->displayClause();
+		std::cout << "Subsumed by:\n";
+		subsumer->displayClause();
+		std::cout << DIVIDER_2;
+	}
+	g_given_subsumed_count++;
+	if(g_activity_selector != nullptr)
+	{
+		g_activity_selector->bumpClause(subsumer);
+	}
+	// the clause may still be queued for selection so leave it as dead
+	non_saturated_index.lazyRemoveFromIndex(given);
+	g_archive->push_back(given);
+	return true;
+}
+
 /*--------------------------------------------------------------------------
 	unitPropagation
 
@@ -829,6 +1600,11 @@ std::list<Clause*>* propagateUnitClause(std::list<Clause*>* non_unit_clauses,
 					clause_literal_index_right[offset];
 				pair.list->erase(pair.literal_iterator);
 			}
+			if(LiteralList::use_literal_masks)
+			{
+				// the literal was erased directly so rebuild the bitmasks
+				non_unit_clause->calculateLiteralMasks();
+			}
 
 			if(non_unit_clause->getClauseType() == ClauseType::INITIAL ||
 				non_unit_clause->getClauseType() == ClauseType::UNIVERSAL)
@@ -988,6 +1764,224 @@ void purityDeletion(std::list<Clause*>* clauses)
 	}
 }
 
+/*--------------------------------------------------------------------------
+	splitLongClauses
+
+	Replaces each universal or initial clause in the given list having more
+	than g_split_length literals by a clause holding its smallest literals and
+	a new literal naming the component made of its remaining literals. Each
+	name is defined by a universal clause implying its component, which is
+	split again if it is too long. Only components shared by at least two
+	clauses are named, so that the inferences on a component are made once
+	in its definition rather than in every clause containing it. Each name is
+	ordered just below the smallest literal of its component, so it is the
+	maximal literal of the clauses using it and the least literal of its
+	definition, and a clause using it is only resolved upon once the
+	component has been eliminated from the definition. The positive names to
+	be ordered just below each positive parsed literal are added to the given
+	map.
+--------------------------------------------------------------------------*/
+void splitLongClauses(std::list<Clause*>* clauses,
+	std::map<Literal*, std::vector<Literal*>>& names_below)
+{
+	// the positive parsed literals, greatest first
+	std::vector<Literal*> parsed = literal_ordering::generateOrdering(clauses,
+		ORDER_INPUT);
+	// the number of clauses and definitions sharing each component
+	std::map<std::vector<Literal*>, int> component_uses;
+	// the positive literal naming each component
+	std::map<std::vector<Literal*>, Literal*> component_names;
+	// the definitions of the names
+	std::list<Clause*> definitions;
+	// the identifier of the clause being split
+	int identifier = 0;
+	// builds a clause of the given type from the given literals
+	auto build_clause =
+		[&](const std::vector<Literal*>& literals, ClauseType type)
+		{
+			Clause* c = new Clause(new LiteralList(), new std::list<int>(),
+				new LiteralList(), type, new Justification(identifier, -1,
+					nullptr, InferenceRule::SPLIT), nullptr);
+			std::for_each(literals.begin(), literals.end(), [&](Literal* l)
+				{
+					c->addLiteral(l, false);
+				});
+			return c;
+		};
+	/* counts the uses of the component that would be split from the given
+	   literals, ordered by increasing rank, and of the components of its
+	   definition when it is first used */
+	std::function<void(const std::vector<Literal*>&, unsigned int)>
+		count_components =
+		[&](const std::vector<Literal*>& literals, unsigned int length)
+		{
+			if(literals.size() <= length)
+			{
+				return;
+			}
+			std::vector<Literal*> component(literals.begin() + (length - 1),
+				literals.end());
+			if(component_uses[component]++ == 0)
+			{
+				count_components(component, g_split_length - 1);
+			}
+		};
+	/* returns the given literals, ordered by increasing rank, if there are
+	   no more than the given number of them or their component is not
+	   shared, and otherwise the smallest of them followed by the name of the
+	   component made of the others */
+	std::function<std::vector<Literal*>(const std::vector<Literal*>&,
+		unsigned int)> shorten =
+		[&](const std::vector<Literal*>& literals, unsigned int length)
+		{
+			if(literals.size() <= length)
+			{
+				return literals;
+			}
+			std::vector<Literal*> component(literals.begin() + (length - 1),
+				literals.end());
+			if(component_uses[component] < 2)
+			{
+				return literals;
+			}
+			std::vector<Literal*> shortened(literals.begin(),
+				literals.begin() + (length - 1));
+			std::map<std::vector<Literal*>, Literal*>::iterator it =
+				component_names.find(component);
+			if(it != component_names.end())
+			{
+				shortened.push_back(it->second);
+				return shortened;
+			}
+			std::pair<Literal*, Literal*>* name =
+				Literal::constructLiteralPair(SPLIT_NAME_PREFIX +
+					std::to_string(++g_split_names));
+			name->first->is_used = true;
+			name->second->is_used = true;
+			g_literals->push_back(name->first);
+			g_literals->push_back(name->second);
+			Literal* smallest = component.front()->polarity ?
+				component.front() : component.front()->complementary_literal;
+			names_below[smallest].push_back(name->first);
+			component_names[component] = name->first;
+			shortened.push_back(name->first);
+			/* define the name, leaving room for its negation, the definition
+			   may itself need splitting */
+			std::vector<Literal*> definition = shorten(component,
+				g_split_length - 1);
+			definition.push_back(name->second);
+			definitions.push_back(build_clause(definition,
+				ClauseType::UNIVERSAL));
+			delete name;
+			return shortened;
+		};
+
+	// returns true if the given clause is long enough to be split
+	auto is_long = [](Clause* c)
+		{
+			return (c->getClauseType() == ClauseType::UNIVERSAL ||
+				c->getClauseType() == ClauseType::INITIAL) &&
+				c->getRight()->size() > g_split_length;
+		};
+	std::for_each(clauses->begin(), clauses->end(), [&](Clause* c)
+		{
+			if(is_long(c))
+			{
+				count_components(std::vector<Literal*>(
+					c->getRight()->getList()->begin(),
+					c->getRight()->getList()->end()), g_split_length);
+			}
+		});
+
+	std::list<Clause*>::iterator clauses_it = clauses->begin();
+	std::list<Clause*>::iterator clauses_end = clauses->end();
+	while(clauses_it != clauses_end)
+	{
+		Clause* c = *clauses_it;
+		if(!is_long(c))
+		{
+			clauses_it++;
+			continue;
+		}
+		identifier = c->getIdentifier();
+		std::size_t definition_count = definitions.size();
+		std::vector<Literal*> literals(c->getRight()->getList()->begin(),
+			c->getRight()->getList()->end());
+		std::vector<Literal*> shortened = shorten(literals, g_split_length);
+		if(shortened.size() == literals.size())
+		{
+			// the component of the clause is not shared
+			clauses_it++;
+			continue;
+		}
+		g_split_clauses++;
+		Clause* split_clause = build_clause(shortened, c->getClauseType());
+		if(g_verbosity >= V_MAXIMAL)
+		{
+			std::cout << DIVIDER_1;
+			std::cout << "Splitting clause:\n";
+			c->displayClause();
+			std::cout << "Into clauses:\n";
+			split_clause->displayClause();
+			std::for_each(std::next(definitions.begin(), definition_count),
+				definitions.end(), [](Clause* definition)
+				{
+					definition->displayClause();
+				});
+			std::cout << DIVIDER_1;
+		}
+		if(g_support_clauses->count(identifier) != 0)
+		{
+			// the split clause replaces the chosen clause in the set of support
+			g_support_clauses->insert(split_clause->getIdentifier());
+		}
+		*clauses_it++ = split_clause;
+		g_archive->push_back(c);
+	}
+	if(names_below.empty())
+	{
+		return;
+	}
+	clauses->splice(clauses->end(), definitions);
+	literal_ordering::applyOrdering(placeSplitNames(parsed, names_below),
+		clauses);
+}
+
+/*--------------------------------------------------------------------------
+	placeSplitNames
+
+	Returns the given ordering of positive literals, greatest first, with the
+	names of split components moved just below the literals they are mapped
+	from by the given map.
+--------------------------------------------------------------------------*/
+std::vector<Literal*> placeSplitNames(const std::vector<Literal*>& ordering,
+	const std::map<Literal*, std::vector<Literal*>>& names_below)
+{
+	std::set<Literal*> names;
+	std::for_each(names_below.begin(), names_below.end(),
+		[&](const std::pair<Literal* const, std::vector<Literal*>>& below)
+		{
+			names.insert(below.second.begin(), below.second.end());
+		});
+	std::vector<Literal*> placed;
+	std::for_each(ordering.begin(), ordering.end(), [&](Literal* l)
+		{
+			if(names.count(l) != 0)
+			{
+				return;
+			}
+			placed.push_back(l);
+			std::map<Literal*, std::vector<Literal*>>::const_iterator it =
+				names_below.find(l);
+			if(it != names_below.end())
+			{
+				placed.insert(placed.end(), it->second.begin(),
+					it->second.end());
+			}
+		});
+	return placed;
+}
+
 /*--------------------------------------------------------------------------
 	cleanup
 
@@ -1011,6 +2005,7 @@ void cleanup()
 
 	delete g_archive;
 	delete g_literals;
+	delete g_support_clauses;
 }
 
 /*--------------------------------------------------------------------------
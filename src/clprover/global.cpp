@@ -2,7 +2,7 @@
 	File			: global.cpp
 	Author			: Paul Gainer
 	Created			: 22/06/2014
-	Last modified	: 18/04/2015
+	Last modified	: 18/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -33,13 +33,26 @@ const std::string EXEC_NAME = "CLProver++";
 
 std::list<Clause*>* g_archive = new std::list<Clause*>();
 std::vector<Literal*>* g_literals = new std::vector<Literal*>();
+std::set<int>* g_support_clauses = new std::set<int>();
 Clause* g_contradiction = nullptr;
+ActivitySelector* g_activity_selector = nullptr;
 int g_heuristic = GET_NEXT_SMALLEST;
+int g_loop_style = OTTER_LOOP;
+int g_literal_selection = SELECT_MAXIMAL;
+int g_literal_ordering = ORDER_INPUT;
+int g_split_length = SPLIT_DISABLED;
+int g_symmetry_length = SYMMETRY_DISABLED;
+int g_weight_function = WEIGHT_SYMBOL_COUNT;
+int g_weight_ratio = 5;
+int g_set_of_support = SOS_DISABLED;
+int g_backward_batch_size = 1;
 int g_num_agents = AGENT_NUM_NOT_SET;
 int g_verbosity = V_DEFAULT;
 int g_inference_count_tautology = 0;
 int g_inference_count_ires1 = 0;
 int g_inference_count_gres1 = 0;
+int g_inference_count_hres = 0;
+int g_hres_subsumed_partials = 0;
 int g_inference_count_cres1 = 0;
 int g_inference_count_cres2 = 0;
 int g_inference_count_cres3 = 0;
@@ -47,10 +60,23 @@ int g_inference_count_cres4 = 0;
 int g_inference_count_cres5 = 0;
 int g_backward_subsumed_count = 0;
 int g_forward_subsumed_count = 0;
+int g_given_subsumed_count = 0;
+long g_backward_subsumption_candidates = 0;
+int g_forward_subsumption_resolutions = 0;
+int g_backward_subsumption_resolutions = 0;
+long g_sos_skipped_partners = 0;
+int g_sos_reopened_clauses = 0;
+int g_coalition_merges_skipped = 0;
+int g_subsumer_cache_hits = 0;
+int g_subsumer_cache_misses = 0;
+int g_batch_duplicate_resolvents = 0;
+int g_recent_duplicate_resolvents = 0;
 int g_rewrite_count = 0;
 int g_unit_propagation_clauses_removed = 0;
 int g_unit_propagation_literals_removed = 0;
 int g_purity_deletion_clauses_eliminated = 0;
+int g_split_clauses = 0;
+int g_split_names = 0;
 bool g_increment_literal_ranks = true;
 bool g_display_modality_as_vector = false;
 bool g_display_extra_inference_information = false;
@@ -58,3 +84,9 @@ bool g_unit_propagation = false;
 bool g_purity_deletion = false;
 bool g_forward_subsumption = true;
 bool g_backward_subsumption = false;
+bool g_subsumption_resolution = false;
+bool g_coalition_support = false;
+bool g_hyperresolution = false;
+bool g_adaptive_scheduling = false;
+bool g_literal_masks = true;
+bool g_unified_index = false;
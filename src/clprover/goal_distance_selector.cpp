@@ -0,0 +1,219 @@
+/*==============================================================================
+	File			: goal_distance_selector.cpp
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 18/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#include <algorithm>
+#include <iostream>
+
+#include "clprover/define.h"
+#include "clprover/goal_distance_selector.h"
+
+#include "data_structures/clause.h"
+#include "data_structures/literal.h"
+#include "data_structures/literal_list.h"
+
+/*==============================================================================
+	Constructors/Deconstructor
+==============================================================================*/
+GoalDistanceSelector::GoalDistanceSelector(int max_rank):
+	unreachable(max_rank + 1), distances(max_rank + 1, max_rank + 1),
+	links(max_rank + 1), complements(max_rank + 1, 0),
+	selections(GOAL_RESCORE_INTERVAL)
+{
+}
+
+/*==============================================================================
+	Public Functions
+==============================================================================*/
+void GoalDistanceSelector::addClause(Clause* clause)
+{
+	// collect the ranks of the literals of the clause
+	std::vector<int> ranks;
+	for(LiteralList* literal_list : {clause->getLeft(), clause->getRight()})
+	{
+		if(literal_list->getList() != nullptr)
+		{
+			std::for_each(literal_list->getList()->begin(),
+				literal_list->getList()->end(),
+				[&](Literal* l)
+				{
+					ranks.push_back(l->rank);
+					complements[l->rank] = l->complementary_literal->rank;
+					complements[l->complementary_literal->rank] = l->rank;
+				});
+		}
+	}
+	// link the literals that occur together in the clause
+	std::for_each(ranks.begin(), ranks.end(),
+		[&](int this_rank)
+		{
+			std::for_each(ranks.begin(), ranks.end(),
+				[&](int that_rank)
+				{
+					if(this_rank != that_rank)
+					{
+						links[this_rank].insert(that_rank);
+					}
+				});
+		});
+	if(clause->getClauseType() == ClauseType::INITIAL)
+	{
+		// the literals of initial clauses are the goal
+		std::for_each(ranks.begin(), ranks.end(),
+			[&](int rank)
+			{
+				lowerDistance(rank, 0);
+			});
+	}
+	else if(!ranks.empty())
+	{
+		// the new links can only shorten distances through this clause
+		int closest = unreachable;
+		std::for_each(ranks.begin(), ranks.end(),
+			[&](int rank)
+			{
+				closest = std::min(closest, distances[rank]);
+			});
+		if(closest < unreachable)
+		{
+			std::for_each(ranks.begin(), ranks.end(),
+				[&](int rank)
+				{
+					lowerDistance(rank, closest + 1);
+				});
+		}
+	}
+	queue.push_back({score(clause), clause->getIdentifier(), clause});
+	std::push_heap(queue.begin(), queue.end());
+}
+
+Clause* GoalDistanceSelector::getNext()
+{
+	if(distances_changed && ++selections >= GOAL_RESCORE_INTERVAL)
+	{
+		rescore();
+		selections = 0;
+	}
+	while(!queue.empty())
+	{
+		std::pop_heap(queue.begin(), queue.end());
+		Clause* clause = queue.back().clause;
+		queue.pop_back();
+		if(!clause->isSaturated() && !clause->isDead())
+		{
+			return clause;
+		}
+		entries_skipped++;
+	}
+	return nullptr;
+}
+
+void GoalDistanceSelector::displayStatistics() const
+{
+	std::cout << "Goal distance updates: " << distance_updates << std::endl;
+	std::cout << "Goal distance queue rescores: " << rescores << std::endl;
+	std::cout << "Stale selection queue entries skipped: " <<
+		entries_skipped << std::endl;
+}
+
+/*==============================================================================
+	Private Functions
+==============================================================================*/
+int GoalDistanceSelector::score(const Clause* clause) const
+{
+	int closest = unreachable;
+	for(LiteralList* literal_list : {clause->getLeft(), clause->getRight()})
+	{
+		if(literal_list->getList() != nullptr)
+		{
+			std::for_each(literal_list->getList()->begin(),
+				literal_list->getList()->end(),
+				[&](Literal* l)
+				{
+					closest = std::min(closest, distances[l->rank]);
+				});
+		}
+	}
+	return closest + clause->size();
+}
+
+void GoalDistanceSelector::lowerDistance(int rank, int distance)
+{
+	if(distance >= distances[rank])
+	{
+		return;
+	}
+	distances[rank] = distance;
+	distance_updates++;
+	distances_changed = true;
+	// breadth first through the linked literals and complements
+	std::vector<int> frontier(1, rank);
+	while(!frontier.empty())
+	{
+		std::vector<int> next_frontier;
+		std::for_each(frontier.begin(), frontier.end(),
+			[&](int this_rank)
+			{
+				int next_distance = distances[this_rank] + 1;
+				auto relax =
+					[&](int that_rank)
+					{
+						if(that_rank != 0 && next_distance < distances[that_rank])
+						{
+							distances[that_rank] = next_distance;
+							distance_updates++;
+							next_frontier.push_back(that_rank);
+						}
+					};
+				relax(complements[this_rank]);
+				std::for_each(links[this_rank].begin(), links[this_rank].end(),
+					relax);
+			});
+		frontier.swap(next_frontier);
+	}
+}
+
+void GoalDistanceSelector::rescore()
+{
+	// drop the stale entries and score the waiting clauses again
+	std::vector<ScoredClause> rescored_queue;
+	rescored_queue.reserve(queue.size());
+	std::for_each(queue.begin(), queue.end(),
+		[&](ScoredClause& entry)
+		{
+			if(entry.clause->isSaturated() || entry.clause->isDead())
+			{
+				entries_skipped++;
+				return;
+			}
+			entry.score = score(entry.clause);
+			rescored_queue.push_back(entry);
+		});
+	std::make_heap(rescored_queue.begin(), rescored_queue.end());
+	queue.swap(rescored_queue);
+	distances_changed = false;
+	rescores++;
+}
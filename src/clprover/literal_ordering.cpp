@@ -0,0 +1,268 @@
+/*==============================================================================
+	File			: literal_ordering.cpp
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 18/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include <iostream>
+
+#include "clprover/define.h"
+#include "clprover/global.h"
+#include "clprover/literal_ordering.h"
+
+#include "data_structures/clause.h"
+#include "data_structures/literal.h"
+#include "data_structures/literal_list.h"
+
+std::vector<Literal*> literal_ordering::generateOrdering(
+	std::list<Clause*>* clauses, int generator)
+{
+	// the positive literals, greatest first in the current ordering
+	std::vector<Literal*> ordering;
+	std::for_each(g_literals->begin(), g_literals->end(), [&](Literal* l)
+		{
+			if(l->polarity)
+			{
+				ordering.push_back(l);
+			}
+		});
+	std::sort(ordering.begin(), ordering.end(),
+		[](Literal* this_literal, Literal* that_literal)
+		{
+			return this_literal->rank > that_literal->rank;
+		});
+	/* the graph linking each clause to the positive literals of its literals,
+	   indexed by position in the current ordering */
+	std::vector<int> position(g_literals->size() + 1, 0);
+	for(unsigned int i = 0; i < ordering.size(); i++)
+	{
+		position[ordering[i]->rank] = i;
+		position[ordering[i]->complementary_literal->rank] = i;
+	}
+	std::vector<std::vector<int>> clause_literals;
+	std::vector<std::vector<int>> literal_clauses(ordering.size());
+	std::vector<bool> initial(ordering.size(), false);
+	std::for_each(clauses->begin(), clauses->end(), [&](Clause* c)
+		{
+			std::vector<int> literals;
+			for(LiteralList* literal_list : {c->getLeft(), c->getRight()})
+			{
+				if(literal_list->getList() != nullptr)
+				{
+					std::for_each(literal_list->getList()->begin(),
+						literal_list->getList()->end(),
+						[&](Literal* l)
+						{
+							int p = position[l->rank];
+							literals.push_back(p);
+							literal_clauses[p].push_back(
+								clause_literals.size());
+							initial[p] = initial[p] ||
+								c->getClauseType() == ClauseType::INITIAL;
+						});
+				}
+			}
+			clause_literals.push_back(literals);
+		});
+	// the literals linked to a literal through a clause, in some order
+	auto neighbours =
+		[&](int p, std::vector<bool>& reached)
+		{
+			std::vector<int> result;
+			std::for_each(literal_clauses[p].begin(), literal_clauses[p].end(),
+				[&](int c)
+				{
+					std::for_each(clause_literals[c].begin(),
+						clause_literals[c].end(), [&](int q)
+						{
+							if(!reached[q])
+							{
+								reached[q] = true;
+								result.push_back(q);
+							}
+						});
+				});
+			return result;
+		};
+	// the key of each literal, the literals are ordered by increasing keys
+	std::vector<int> keys(ordering.size(), INT_MAX);
+	if(generator == ORDER_FREQUENCY)
+	{
+		for(unsigned int p = 0; p < ordering.size(); p++)
+		{
+			keys[p] = literal_clauses[p].size();
+		}
+	}
+	else if(generator == ORDER_INITIAL_FIRST)
+	{
+		// breadth first from the literals of the initial clauses
+		std::vector<bool> reached(initial);
+		std::vector<int> frontier;
+		for(unsigned int p = 0; p < ordering.size(); p++)
+		{
+			if(initial[p])
+			{
+				keys[p] = 0;
+				frontier.push_back(p);
+			}
+		}
+		for(int distance = 1; !frontier.empty(); distance++)
+		{
+			std::vector<int> next_frontier;
+			std::for_each(frontier.begin(), frontier.end(), [&](int p)
+				{
+					std::vector<int> next = neighbours(p, reached);
+					std::for_each(next.begin(), next.end(), [&](int q)
+						{
+							keys[q] = distance;
+						});
+					next_frontier.insert(next_frontier.end(), next.begin(),
+						next.end());
+				});
+			frontier.swap(next_frontier);
+		}
+	}
+	else if(generator == ORDER_CUTHILL_MCKEE)
+	{
+		/* breadth first from a literal of least degree in each component,
+		   visiting the literals linked to each literal by increasing degree,
+		   the reverse of the order visited is the ordering */
+		std::vector<bool> reached(ordering.size(), false);
+		std::vector<int> by_degree(ordering.size());
+		for(unsigned int p = 0; p < ordering.size(); p++)
+		{
+			by_degree[p] = p;
+		}
+		auto less_degree =
+			[&](int p, int q)
+			{
+				return literal_clauses[p].size() < literal_clauses[q].size();
+			};
+		std::stable_sort(by_degree.begin(), by_degree.end(), less_degree);
+		int visited = ordering.size();
+		std::for_each(by_degree.begin(), by_degree.end(), [&](int start)
+			{
+				if(reached[start])
+				{
+					return;
+				}
+				reached[start] = true;
+				std::vector<int> queue(1, start);
+				for(unsigned int i = 0; i < queue.size(); i++)
+				{
+					keys[queue[i]] = --visited;
+					std::vector<int> next = neighbours(queue[i], reached);
+					std::stable_sort(next.begin(), next.end(), less_degree);
+					queue.insert(queue.end(), next.begin(), next.end());
+				}
+			});
+	}
+	std::vector<int> order(ordering.size());
+	for(unsigned int p = 0; p < ordering.size(); p++)
+	{
+		order[p] = p;
+	}
+	std::stable_sort(order.begin(), order.end(), [&](int p, int q)
+		{
+			return keys[p] < keys[q];
+		});
+	std::vector<Literal*> generated;
+	std::for_each(order.begin(), order.end(), [&](int p)
+		{
+			generated.push_back(ordering[p]);
+		});
+	return generated;
+}
+
+void literal_ordering::applyOrdering(const std::vector<Literal*>& ordering,
+	std::list<Clause*>* clauses)
+{
+	// the least positive literal has rank 1 and its complement rank 2
+	int rank = 2 * ordering.size();
+	std::for_each(ordering.begin(), ordering.end(), [&](Literal* l)
+		{
+			l->complementary_literal->rank = rank--;
+			l->rank = rank--;
+		});
+	std::sort(g_literals->begin(), g_literals->end(),
+		[](Literal* this_literal, Literal* that_literal)
+		{
+			return g_increment_literal_ranks ?
+				this_literal->rank < that_literal->rank :
+				this_literal->rank > that_literal->rank;
+		});
+	// restore the order of the literals of each clause
+	for(std::list<Clause*>* clause_list : {clauses, g_archive})
+	{
+		std::for_each(clause_list->begin(), clause_list->end(),
+			[](Clause* c)
+			{
+				c->getLeft()->sortByRank();
+				c->getRight()->sortByRank();
+			});
+	}
+	if(LiteralList::use_literal_masks)
+	{
+		std::for_each(clauses->begin(), clauses->end(), [](Clause* c)
+			{
+				c->calculateLiteralMasks();
+			});
+	}
+}
+
+bool literal_ordering::writeOrderingFile(const std::string& file_name)
+{
+	std::ofstream ordering_file(file_name.c_str());
+	if(!ordering_file.good())
+	{
+		std::cout << EXEC_NAME << " error: could not write file '" <<
+			file_name << "'" << std::endl;
+		return false;
+	}
+	/* the positive literals, greatest first, leaving out the names of split
+	   components as they do not occur in the input */
+	std::vector<Literal*> ordering;
+	std::for_each(g_literals->begin(), g_literals->end(), [&](Literal* l)
+		{
+			if(l->polarity && l->identifier.compare(0,
+				std::string(SPLIT_NAME_PREFIX).size(), SPLIT_NAME_PREFIX) != 0)
+			{
+				ordering.push_back(l);
+			}
+		});
+	std::sort(ordering.begin(), ordering.end(),
+		[](Literal* this_literal, Literal* that_literal)
+		{
+			return this_literal->rank > that_literal->rank;
+		});
+	for(unsigned int i = 0; i < ordering.size(); i++)
+	{
+		ordering_file << (i == 0 ? "" : " > ") << ordering[i]->identifier;
+	}
+	ordering_file << std::endl;
+	return ordering_file.good();
+}
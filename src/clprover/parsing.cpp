@@ -2,7 +2,7 @@
 	File			: parsing.cpp
 	Author			: Paul Gainer
 	Created			: 22/06/2014
-	Last modified	: 18/04/2015
+	Last modified	: 18/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -106,6 +106,48 @@ bool parseOrderingFile(const std::string& input_file_name)
 	return parser.parse();
 }
 
+bool parseSupportFile(const std::string& input_file_name)
+{
+	std::string identifier;
+
+	FileParser parser(EXEC_NAME, g_verbosity == V_DEBUG,
+		FileParser::IGNORE_WHITESPACE);
+	if(!parser.setInputFile(input_file_name))
+	{
+		return false;
+	}
+
+	FileParserState state_0("state 0");
+	FileParserState state_1("state 1");
+
+	state_0.addTransition(FileParserTransition('0', '9',
+		[&](char input_character)
+		{
+			identifier = input_character;
+		}, state_1));
+	state_0.addTransition(FileParserTransition(EOF,
+		[&](char input_character) {}, FileParserState::TERMINAL_STATE));
+
+	state_1.addTransition(FileParserTransition('0', '9',
+		[&](char input_character)
+		{
+			identifier += input_character;
+		}, state_1));
+	state_1.addTransition(FileParserTransition(',',
+		[&](char input_character)
+		{
+			g_support_clauses->insert(std::stoi(identifier));
+		}, state_0));
+	state_1.addTransition(FileParserTransition(EOF,
+		[&](char input_character)
+		{
+			g_support_clauses->insert(std::stoi(identifier));
+		}, FileParserState::TERMINAL_STATE));
+
+	parser.setInitialState(state_0);
+	return parser.parse();
+}
+
 std::list<Clause*>* parseInputFile(const std::string& input_file_name)
 {
 	std::list<Clause*>* parsed_clauses = new std::list<Clause*>();
@@ -0,0 +1,139 @@
+/*==============================================================================
+	File			: simplification_scheduler.cpp
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 18/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#include <algorithm>
+#include <climits>
+#include <iostream>
+
+#include "clprover/define.h"
+#include "clprover/simplification_scheduler.h"
+
+#include "data_structures/clause.h"
+
+/*==============================================================================
+	Constructors/Deconstructor
+==============================================================================*/
+SimplificationScheduler::SimplificationScheduler(const std::string& name):
+	name(name), size_limit(INT_MAX)
+{
+	window_candidates = new long[ADAPTIVE_WINDOW_SIZE];
+	window_removed = new int[ADAPTIVE_WINDOW_SIZE];
+	std::fill(window_candidates, window_candidates + ADAPTIVE_WINDOW_SIZE, 0);
+	std::fill(window_removed, window_removed + ADAPTIVE_WINDOW_SIZE, 0);
+}
+
+SimplificationScheduler::~SimplificationScheduler()
+{
+	delete[] window_candidates;
+	delete[] window_removed;
+}
+
+/*==============================================================================
+	Public Functions
+==============================================================================*/
+std::list<Clause*>* SimplificationScheduler::selectClauses(
+	std::list<Clause*>* clause_list)
+{
+	std::list<Clause*>* selected_clauses = new std::list<Clause*>();
+	std::for_each(clause_list->begin(), clause_list->end(),
+		[&](Clause* c)
+		{
+			max_clause_size = std::max(max_clause_size, c->size());
+			if(c->size() <= size_limit)
+			{
+				selected_clauses->push_back(c);
+			}
+		});
+	clauses_selected += selected_clauses->size();
+	clauses_skipped += clause_list->size() - selected_clauses->size();
+	application_start = clock();
+	return selected_clauses;
+}
+
+void SimplificationScheduler::recordApplication(long application_candidates,
+	int application_removed)
+{
+	time += clock() - application_start;
+	applications++;
+	candidates += application_candidates;
+	removed += application_removed;
+
+	// replace the oldest application in the window
+	window_candidates_total += application_candidates -
+		window_candidates[window_position];
+	window_removed_total += application_removed -
+		window_removed[window_position];
+	window_candidates[window_position] = application_candidates;
+	window_removed[window_position] = application_removed;
+	window_position = (window_position + 1) % ADAPTIVE_WINDOW_SIZE;
+
+	if(window_position != 0)
+	{
+		// the limit is only adapted once per window
+		return;
+	}
+	if(window_removed_total * static_cast<long>(ADAPTIVE_MIN_YIELD) <
+		window_candidates_total)
+	{
+		// too few clauses were removed for the candidates checked
+		int limit = std::max(1, std::min(size_limit, max_clause_size) / 2);
+		if(limit < size_limit)
+		{
+			size_limit = limit;
+			times_lowered++;
+		}
+	}
+	else if(size_limit < max_clause_size)
+	{
+		// the simplification is paying off so let larger clauses take part
+		size_limit++;
+		times_raised++;
+	}
+}
+
+void SimplificationScheduler::displayStatistics() const
+{
+	std::cout << name << " applications: " << applications << std::endl;
+	std::cout << name << " clauses selected: " << clauses_selected <<
+		std::endl;
+	std::cout << name << " clauses skipped: " << clauses_skipped << std::endl;
+	std::cout << name << " candidates checked: " << candidates << std::endl;
+	std::cout << name << " clauses removed: " << removed << std::endl;
+	std::cout << name << " time: " << ((double)time / CLOCKS_PER_SEC) <<
+		" seconds" << std::endl;
+	std::cout << name << " size limit lowered/raised: " << times_lowered <<
+		"/" << times_raised << std::endl;
+	std::cout << name << " final size limit: ";
+	if(size_limit == INT_MAX)
+	{
+		std::cout << "none" << std::endl;
+	}
+	else
+	{
+		std::cout << size_limit << std::endl;
+	}
+}
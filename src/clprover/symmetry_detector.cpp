@@ -0,0 +1,467 @@
+/*==============================================================================
+	File			: symmetry_detector.cpp
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 18/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <numeric>
+
+#include "clprover/define.h"
+#include "clprover/global.h"
+#include "clprover/symmetry_detector.h"
+
+#include "data_structures/clause.h"
+#include "data_structures/justification.h"
+#include "data_structures/literal.h"
+#include "data_structures/literal_list.h"
+
+/*==============================================================================
+	Constructors/Deconstructor
+==============================================================================*/
+SymmetryDetector::SymmetryDetector(int max_size): max_size(max_size)
+{
+}
+
+/*==============================================================================
+	Public Functions
+==============================================================================*/
+void SymmetryDetector::detectSymmetries(std::list<Clause*>* clauses)
+{
+	this->clauses = clauses;
+	// index the literals by rank
+	literals.assign(g_literals->size() + 1, nullptr);
+	std::for_each(g_literals->begin(), g_literals->end(),
+		[&](Literal* l)
+		{
+			literals[l->rank] = l;
+		});
+	// number the propositions occurring in the clauses
+	std::vector<int> proposition_of(literals.size(), -1);
+	std::for_each(clauses->begin(), clauses->end(), [&](Clause* c)
+		{
+			for(LiteralList* literal_list : {c->getLeft(), c->getRight()})
+			{
+				if(literal_list->getList() != nullptr)
+				{
+					std::for_each(literal_list->getList()->begin(),
+						literal_list->getList()->end(),
+						[&](Literal* l)
+						{
+							Literal* positive = l->polarity ? l :
+								l->complementary_literal;
+							if(proposition_of[positive->rank] == -1)
+							{
+								proposition_of[positive->rank] =
+									propositions.size();
+								propositions.push_back(positive);
+							}
+						});
+				}
+			}
+		});
+	num_propositions = propositions.size();
+	/* link each clause to its propositions, the clauses are coloured by type,
+	   agents, coalition vector and size and the propositions are uncoloured */
+	edges.assign(num_propositions + clauses->size(),
+		std::vector<std::pair<int, int>>());
+	std::vector<int> colours(edges.size(), 0);
+	std::vector<std::vector<int>> shapes;
+	int vertex = num_propositions;
+	std::for_each(clauses->begin(), clauses->end(), [&](Clause* c)
+		{
+			clause_keys.insert(clauseKey(c, nullptr));
+			std::vector<int> shape(1, c->getClauseType());
+			shape.insert(shape.end(), c->getAgents()->begin(),
+				c->getAgents()->end());
+			shape.push_back(-1);
+			if(c->getCoalitionVector() != nullptr)
+			{
+				shape.insert(shape.end(), c->getCoalitionVector()->begin(),
+					c->getCoalitionVector()->end());
+			}
+			shape.push_back(-1);
+			shape.push_back(c->getLeft()->size());
+			shape.push_back(c->getRight()->size());
+			shapes.push_back(shape);
+			// the label of an edge is its side and the polarity of the literal
+			int side = 2;
+			for(LiteralList* literal_list : {c->getLeft(), c->getRight()})
+			{
+				if(literal_list->getList() != nullptr)
+				{
+					std::for_each(literal_list->getList()->begin(),
+						literal_list->getList()->end(),
+						[&](Literal* l)
+						{
+							int proposition = proposition_of[l->polarity ?
+								l->rank : l->complementary_literal->rank];
+							int label = side + (l->polarity ? 1 : 0);
+							edges[vertex].push_back(std::make_pair(label,
+								proposition));
+							edges[proposition].push_back(std::make_pair(label,
+								vertex));
+						});
+				}
+				side = 0;
+			}
+			vertex++;
+		});
+	std::vector<std::vector<int>> sorted_shapes(shapes);
+	std::sort(sorted_shapes.begin(), sorted_shapes.end());
+	sorted_shapes.erase(std::unique(sorted_shapes.begin(),
+		sorted_shapes.end()), sorted_shapes.end());
+	for(unsigned int i = 0; i < shapes.size(); i++)
+	{
+		colours[num_propositions + i] = 1 + (std::lower_bound(
+			sorted_shapes.begin(), sorted_shapes.end(), shapes[i]) -
+			sorted_shapes.begin());
+	}
+	std::vector<int> same_colours(colours);
+	refine(colours, same_colours);
+
+	// the propositions of each colour, a symmetry only permutes within them
+	std::map<int, std::vector<int>> cells;
+	for(int p = 0; p < num_propositions; p++)
+	{
+		cells[colours[p]].push_back(p);
+	}
+	// the orbits of the propositions under the symmetries found so far
+	std::vector<int> orbits(num_propositions);
+	std::iota(orbits.begin(), orbits.end(), 0);
+	auto find_orbit =
+		[&](int p)
+		{
+			while(orbits[p] != p)
+			{
+				p = orbits[p] = orbits[orbits[p]];
+			}
+			return p;
+		};
+	int individual_colour =
+		*std::max_element(colours.begin(), colours.end()) + 1;
+	for(auto& cell : cells)
+	{
+		int first = cell.second.front();
+		for(unsigned int i = 1; i < cell.second.size(); i++)
+		{
+			if(search_nodes >= SYMMETRY_SEARCH_BUDGET ||
+				generators.size() >= SYMMETRY_MAX_GENERATORS)
+			{
+				return;
+			}
+			int other = cell.second[i];
+			if(find_orbit(first) == find_orbit(other))
+			{
+				// a known symmetry already maps the first to the other
+				continue;
+			}
+			// look for a symmetry mapping the first proposition to the other
+			std::vector<int> left(colours);
+			std::vector<int> right(colours);
+			left[first] = individual_colour;
+			right[other] = individual_colour;
+			std::vector<int> generator;
+			if(search(left, right, generator))
+			{
+				for(int p = 0; p < num_propositions; p++)
+				{
+					orbits[find_orbit(p)] = find_orbit(proposition_of[
+						generator[propositions[p]->rank]]);
+				}
+				if(g_verbosity >= V_MAXIMAL)
+				{
+					displayGenerator(generator);
+				}
+				generators.push_back(generator);
+			}
+		}
+	}
+}
+
+void SymmetryDetector::addImages(Clause* clause,
+	std::list<Clause*>* clause_list)
+{
+	if(generators.empty() || clause->getJustification() == nullptr ||
+		clause->size() > max_size)
+	{
+		// the images of the input clauses are input clauses
+		return;
+	}
+	std::vector<int> key = clauseKey(clause, nullptr);
+	std::for_each(generators.begin(), generators.end(),
+		[&](const std::vector<int>& generator)
+		{
+			if(clauseKey(clause, &generator) == key)
+			{
+				// the clause is its own image
+				return;
+			}
+			LiteralList* left = new LiteralList();
+			LiteralList* right = new LiteralList();
+			if(clause->getLeft()->getList() != nullptr)
+			{
+				std::for_each(clause->getLeft()->getList()->begin(),
+					clause->getLeft()->getList()->end(),
+					[&](Literal* l)
+					{
+						left->addLiteral(literals[generator[l->rank]]);
+					});
+			}
+			std::for_each(clause->getRight()->getList()->begin(),
+				clause->getRight()->getList()->end(),
+				[&](Literal* l)
+				{
+					right->addLiteral(literals[generator[l->rank]]);
+				});
+			Clause* image = new Clause(left,
+				new std::list<int>(*clause->getAgents()), right,
+				clause->getClauseType(),
+				new Justification(clause->getIdentifier(), -1, nullptr,
+					InferenceRule::SYM),
+				clause->getCoalitionVector() == nullptr ? nullptr :
+					new std::vector<int>(*clause->getCoalitionVector()),
+				false);
+			image->setSupported(clause->isSupported());
+			clause_list->push_back(image);
+			images_added++;
+		});
+}
+
+void SymmetryDetector::displayStatistics() const
+{
+	std::cout << "Symmetries found: " << generators.size() << std::endl;
+	std::cout << "Symmetry search nodes: " << search_nodes << std::endl;
+	std::cout << "Symmetric images added: " << images_added << std::endl;
+}
+
+/*==============================================================================
+	Private Functions
+==============================================================================*/
+bool SymmetryDetector::refine(std::vector<int>& left, std::vector<int>& right)
+{
+	int num_colours = -1;
+	std::vector<std::vector<int>> left_signatures(edges.size());
+	std::vector<std::vector<int>> right_signatures(edges.size());
+	// the signature of a vertex is its colour and the colours of its edges
+	auto signature =
+		[&](const std::vector<int>& colours, int vertex)
+		{
+			std::vector<std::pair<int, int>> neighbours;
+			neighbours.reserve(edges[vertex].size());
+			std::for_each(edges[vertex].begin(), edges[vertex].end(),
+				[&](const std::pair<int, int>& edge)
+				{
+					neighbours.push_back(std::make_pair(edge.first,
+						colours[edge.second]));
+				});
+			std::sort(neighbours.begin(), neighbours.end());
+			std::vector<int> result(1, colours[vertex]);
+			std::for_each(neighbours.begin(), neighbours.end(),
+				[&](const std::pair<int, int>& neighbour)
+				{
+					result.push_back(neighbour.first);
+					result.push_back(neighbour.second);
+				});
+			return result;
+		};
+	while(true)
+	{
+		// the number of vertices with each signature in each colouring
+		std::map<std::vector<int>, std::pair<int, int>> signatures;
+		for(unsigned int v = 0; v < edges.size(); v++)
+		{
+			left_signatures[v] = signature(left, v);
+			signatures[left_signatures[v]].first++;
+			right_signatures[v] = signature(right, v);
+			signatures[right_signatures[v]].second++;
+		}
+		// the signatures, in order, are the new colours
+		int next_colour = 0;
+		for(auto& entry : signatures)
+		{
+			if(entry.second.first != entry.second.second)
+			{
+				return false;
+			}
+			entry.second.first = next_colour++;
+		}
+		if(next_colour == num_colours)
+		{
+			// no colour was split so the colourings are stable
+			return true;
+		}
+		num_colours = next_colour;
+		for(unsigned int v = 0; v < edges.size(); v++)
+		{
+			left[v] = signatures[left_signatures[v]].first;
+			right[v] = signatures[right_signatures[v]].first;
+		}
+	}
+}
+
+bool SymmetryDetector::search(std::vector<int>& left, std::vector<int>& right,
+	std::vector<int>& generator)
+{
+	if(search_nodes++ >= SYMMETRY_SEARCH_BUDGET || !refine(left, right))
+	{
+		return false;
+	}
+	// find the first proposition sharing its colour
+	int max_colour = *std::max_element(left.begin(), left.end());
+	std::vector<int> cell_sizes(max_colour + 1, 0);
+	for(int p = 0; p < num_propositions; p++)
+	{
+		cell_sizes[left[p]]++;
+	}
+	int chosen = -1;
+	for(int p = 0; p < num_propositions && chosen == -1; p++)
+	{
+		if(cell_sizes[left[p]] > 1)
+		{
+			chosen = p;
+		}
+	}
+	if(chosen == -1)
+	{
+		/* each proposition has its own colour, so map it to the proposition
+		   of that colour and check that the clauses are mapped onto
+		   themselves */
+		std::vector<int> proposition_of_colour(max_colour + 1, -1);
+		for(int q = 0; q < num_propositions; q++)
+		{
+			proposition_of_colour[right[q]] = q;
+		}
+		std::vector<int> permutation(num_propositions);
+		for(int p = 0; p < num_propositions; p++)
+		{
+			permutation[p] = proposition_of_colour[left[p]];
+		}
+		generator = literalPermutation(permutation);
+		return std::all_of(clauses->begin(), clauses->end(),
+			[&](Clause* c)
+			{
+				return clause_keys.count(clauseKey(c, &generator)) > 0;
+			});
+	}
+	// individualise the chosen proposition with each candidate image
+	for(int q = 0; q < num_propositions; q++)
+	{
+		if(right[q] != left[chosen])
+		{
+			continue;
+		}
+		std::vector<int> next_left(left);
+		std::vector<int> next_right(right);
+		next_left[chosen] = max_colour + 1;
+		next_right[q] = max_colour + 1;
+		if(search(next_left, next_right, generator))
+		{
+			return true;
+		}
+		if(search_nodes >= SYMMETRY_SEARCH_BUDGET)
+		{
+			return false;
+		}
+	}
+	return false;
+}
+
+std::vector<int> SymmetryDetector::literalPermutation(
+	const std::vector<int>& permutation) const
+{
+	std::vector<int> generator(literals.size());
+	std::iota(generator.begin(), generator.end(), 0);
+	for(int p = 0; p < num_propositions; p++)
+	{
+		Literal* image = propositions[permutation[p]];
+		generator[propositions[p]->rank] = image->rank;
+		generator[propositions[p]->complementary_literal->rank] =
+			image->complementary_literal->rank;
+	}
+	return generator;
+}
+
+std::vector<int> SymmetryDetector::clauseKey(const Clause* clause,
+	const std::vector<int>* generator) const
+{
+	std::vector<int> key(1, clause->getClauseType());
+	key.insert(key.end(), clause->getAgents()->begin(),
+		clause->getAgents()->end());
+	key.push_back(-1);
+	if(clause->getCoalitionVector() != nullptr)
+	{
+		key.insert(key.end(), clause->getCoalitionVector()->begin(),
+			clause->getCoalitionVector()->end());
+	}
+	for(LiteralList* literal_list : {clause->getLeft(), clause->getRight()})
+	{
+		std::vector<int> ranks;
+		if(literal_list->getList() != nullptr)
+		{
+			std::for_each(literal_list->getList()->begin(),
+				literal_list->getList()->end(),
+				[&](Literal* l)
+				{
+					ranks.push_back(generator == nullptr ? l->rank :
+						(*generator)[l->rank]);
+				});
+		}
+		std::sort(ranks.begin(), ranks.end());
+		key.push_back(-1);
+		key.insert(key.end(), ranks.begin(), ranks.end());
+	}
+	return key;
+}
+
+void SymmetryDetector::displayGenerator(const std::vector<int>& generator)
+	const
+{
+	std::cout << "Symmetry: ";
+	std::vector<bool> displayed(generator.size(), false);
+	std::for_each(propositions.begin(), propositions.end(), [&](Literal* l)
+		{
+			if(displayed[l->rank] || generator[l->rank] == l->rank)
+			{
+				return;
+			}
+			std::cout << "(";
+			int rank = l->rank;
+			do
+			{
+				displayed[rank] = true;
+				std::cout << literals[rank]->identifier;
+				rank = generator[rank];
+				if(rank != l->rank)
+				{
+					std::cout << " ";
+				}
+			}
+			while(rank != l->rank);
+			std::cout << ")";
+		});
+	std::cout << std::endl;
+}
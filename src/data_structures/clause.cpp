@@ -2,7 +2,7 @@
 	File			: clause.cpp
 	Author			: Paul Gainer
 	Created			: 16/06/2014
-	Last modified	: 26/02/2015
+	Last modified	: 19/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -41,18 +41,25 @@
 	Private Static Member Variables
 ==============================================================================*/
 int Clause::next_identifier = 1;
+int Clause::next_provisional_identifier = -1;
 
 const std::string Clause::CLAUSE_TYPE_STRINGS[4] = {"U", "I", "P", "N"};
 
-const std::string Clause::INFERENCE_RULE_STRINGS[9] = {"IRES1", "GRES1", "CRES1",
-	"CRES2", "CRES3", "CRES4", "CRES5", "RW1", "RW2"};
+const std::string Clause::INFERENCE_RULE_STRINGS[13] = {"IRES1", "GRES1",
+	"CRES1", "CRES2", "CRES3", "CRES4", "CRES5", "RW1", "RW2", "SRES", "HRES",
+	"SPLIT", "SYM"};
 
 /*==============================================================================
 	Public Constructors/Deconstructor
 ==============================================================================*/
 Clause::Clause(LiteralList* left, std::list<int>* agents, LiteralList* right,
 		ClauseType clause_type, Justification* justification,
-		std::vector<int>* coalition_vector): active(true), index_node(nullptr)
+		std::vector<int>* coalition_vector, bool assign_identifier):
+		positive_positions(0), negative_positions(0), negative_move(0),
+		coalition_signature(0), agent_signature(0), active(true),
+		saturated(false), dead(false), supported(true), index_node(nullptr),
+		negated_left_nodes(nullptr), selected_literals(nullptr),
+		selected_nodes(nullptr)
 {
 	if(right->size() == 0 && (clause_type == ClauseType::POSITIVE ||
 		clause_type == ClauseType::NEGATIVE))
@@ -67,12 +74,22 @@ Clause::Clause(LiteralList* left, std::list<int>* agents, LiteralList* right,
 		c->clause_type = clause_type;
 		c->justification = justification;
 		c->coalition_vector = coalition_vector;
-		c->identifier = next_identifier++;
+		if(assign_identifier)
+		{
+			// archive the clause to be rewritten
+			c->identifier = next_identifier++;
+			g_archive->push_back(c);
+		}
+		else
+		{
+			/* the clause to be rewritten is only numbered and archived if the
+			   rewritten clause survives simplification */
+			c->identifier = next_provisional_identifier--;
+			rewritten_clause = c;
+		}
 		Justification* j = new Justification(c->identifier, -1, nullptr,
 			clause_type == ClauseType::POSITIVE ?
 				InferenceRule::RW1 : InferenceRule::RW2);
-		// archive the clause to be rewritten
-		g_archive->push_back(c);
 		LiteralList* r = new LiteralList();
 		if(left->list != nullptr)
 		{
@@ -91,13 +108,26 @@ Clause::Clause(LiteralList* left, std::list<int>* agents, LiteralList* right,
 		clause_type = ClauseType::UNIVERSAL;
 		justification = j;
 	}
-	identifier = next_identifier++;
+	identifier = assign_identifier ?
+		next_identifier++ : next_provisional_identifier--;
 	this->left = left;
 	this->agents = agents;
 	this->right = right;
 	this->clause_type = clause_type;
 	this->justification = justification;
 	this->coalition_vector = coalition_vector;
+	if(coalition_vector != nullptr)
+	{
+		for(unsigned int i = 0; i < coalition_vector->size(); i++)
+		{
+			addMoveToShape(i, (*coalition_vector)[i]);
+		}
+	}
+	std::for_each(agents->begin(), agents->end(),
+		[&](int agent)
+		{
+			agent_signature |= static_cast<uint64_t>(1) << (agent & 63);
+		});
 }
 
 Clause::~Clause()
@@ -107,6 +137,10 @@ Clause::~Clause()
 	delete agents;
 	delete coalition_vector;
 	delete justification;
+	delete rewritten_clause;
+	delete[] negated_left_nodes;
+	delete[] selected_nodes;
+	delete selected_literals;
 }
 /*==============================================================================
 	Operator Overloads
@@ -160,8 +194,17 @@ int* Clause::calculateFeatures()
 void Clause::displayClause()
 {
 	std::list<Literal*>::iterator it, end;
-	std::cout << "Clause " << identifier << " (" <<
-		CLAUSE_TYPE_STRINGS[clause_type] << ")  ";
+	std::cout << "Clause ";
+	if(hasIdentifier())
+	{
+		std::cout << identifier;
+	}
+	else
+	{
+		// this resolvent has not yet survived simplification
+		std::cout << "?";
+	}
+	std::cout << " (" << CLAUSE_TYPE_STRINGS[clause_type] << ")  ";
 	if(left->size() > 0)
 	{
 		std::list<Literal*>* left_list = left->list;
@@ -269,6 +312,14 @@ void Clause::displayClause()
 	if(justification != nullptr)
 	{
 		std::cout << "     [" << justification->input_clause_1;
+		if(justification->satellites != nullptr)
+		{
+			std::for_each(justification->satellites->begin(),
+				justification->satellites->end(), [](int satellite)
+				{
+					std::cout << ", " << satellite;
+				});
+		}
 		if(justification->input_clause_2 != -1)
 		{
 			std::cout << ", " <<
@@ -353,6 +404,49 @@ bool Clause::initialSubsumes(Clause* that)
 	}
 }
 
+bool Clause::mayForwardSubsume(Clause* that) const
+{
+	switch(that->clause_type)
+	{
+	case ClauseType::INITIAL:
+		return clause_type == ClauseType::INITIAL ||
+			clause_type == ClauseType::UNIVERSAL;
+
+	case ClauseType::POSITIVE:
+	case ClauseType::NEGATIVE:
+		return clause_type == that->clause_type ||
+			clause_type == ClauseType::UNIVERSAL;
+
+	default:
+		return clause_type == ClauseType::UNIVERSAL;
+	}
+}
+
+Literal* Clause::subsumptionResolves(Clause* that)
+{
+	if(clause_type != ClauseType::UNIVERSAL &&
+		(clause_type != ClauseType::INITIAL ||
+			that->clause_type != ClauseType::INITIAL))
+	{
+		// only universal clauses hold in every state
+		return nullptr;
+	}
+	return right->subsumptionResolves(that->right);
+}
+
+Clause* Clause::subsumptionResolvent(Clause* that, Literal* literal)
+{
+	Clause* resolvent = new Clause(new LiteralList(*left),
+		new std::list<int>(*agents), right->removeLiteral(literal), clause_type,
+		new Justification(identifier, that->identifier, literal,
+			InferenceRule::SRES),
+		coalition_vector == nullptr ?
+			nullptr : new std::vector<int>(*coalition_vector), false);
+	// the reduced clause takes the place of this clause in the set of support
+	resolvent->supported = supported;
+	return resolvent;
+}
+
 std::list<int>* Clause::relativeComplementAgents(
 	Clause* that)
 {
@@ -458,11 +552,61 @@ void Clause::nullifyLeft()
 	left->list = nullptr;
 }
 
+void Clause::assignIdentifier()
+{
+	if(rewritten_clause != nullptr)
+	{
+		// the clause this clause was rewritten from is numbered first
+		rewritten_clause->assignIdentifier();
+		g_archive->push_back(rewritten_clause);
+		Justification* j = new Justification(rewritten_clause->identifier, -1,
+			nullptr, justification->inference_rule);
+		delete justification;
+		justification = j;
+		rewritten_clause = nullptr;
+	}
+	identifier = next_identifier++;
+}
+
+/*==============================================================================
+	Public Static Functions
+==============================================================================*/
+void Clause::assignIdentifiers(std::list<Clause*>* clause_list)
+{
+	std::vector<Clause*> provisional_clauses;
+	std::for_each(clause_list->begin(), clause_list->end(),
+		[&](Clause* c)
+		{
+			if(!c->hasIdentifier())
+			{
+				provisional_clauses.push_back(c);
+			}
+		});
+	// provisional identifiers decrease in the order of construction
+	std::sort(provisional_clauses.begin(), provisional_clauses.end(),
+		[](Clause* this_clause, Clause* that_clause)
+		{
+			return this_clause->identifier > that_clause->identifier;
+		});
+	std::for_each(provisional_clauses.begin(), provisional_clauses.end(),
+		[](Clause* c)
+		{
+			c->assignIdentifier();
+		});
+	// the remaining provisional clauses were discarded
+	next_provisional_identifier = -1;
+}
+
 /*==============================================================================
 	Private Functions
 ==============================================================================*/
 bool Clause::coalitionSubsumes(Clause* that)
 {
+	if((coalition_signature & ~that->coalition_signature) != 0)
+	{
+		// a non-zero move in this vector is missing from the given vector
+		return false;
+	}
 	auto that_agents_it = that->coalition_vector->begin();
 	bool subsumes = true;
 	std::for_each(coalition_vector->begin(), coalition_vector->end(),
@@ -486,6 +630,11 @@ bool Clause::isAgentSubsetOf(Clause* that)
 	{
 		return true;
 	}
+	else if((agent_signature & ~that->agent_signature) != 0)
+	{
+		// an agent in this list is missing from the given list
+		return false;
+	}
 	else if(those->size() == 0)
 	{
 		return false;
@@ -497,3 +646,58 @@ bool Clause::isAgentSubsetOf(Clause* that)
 	return std::includes(those->begin(), those->end(), agents->begin(),
 		agents->end());
 }
+
+void Clause::selectLiterals(const int selection_function)
+{
+	delete selected_literals;
+	selected_literals = nullptr;
+	if(selection_function == SELECT_MAXIMAL || right->size() < 2 ||
+		(clause_type != ClauseType::UNIVERSAL &&
+		clause_type != ClauseType::INITIAL))
+	{
+		/* the maximal literal is resolved upon, coalition clauses never
+		   select so that the CRES rules keep their ordering conditions */
+		return;
+	}
+	Literal* selected_literal = nullptr;
+	std::vector<Literal*>* literals = new std::vector<Literal*>();
+	/* the literals are ordered by increasing rank, so on equal occurrences
+	   the later literal replaces the earlier one */
+	std::for_each(right->getList()->begin(), right->getList()->end(),
+		[&](Literal* l)
+		{
+			if(l->polarity)
+			{
+				return;
+			}
+			if(selection_function == SELECT_ALL_NEGATIVE)
+			{
+				literals->push_back(l);
+			}
+			else if(selected_literal == nullptr ||
+				selection_function == SELECT_NEGATIVE ||
+				l->occurrences <= selected_literal->occurrences)
+			{
+				selected_literal = l;
+			}
+		});
+	if(selected_literal != nullptr)
+	{
+		literals->push_back(selected_literal);
+	}
+	if(literals->empty() || (literals->size() == 1 &&
+		literals->front() == right->getMaximalLiteral()))
+	{
+		// selecting only the maximal literal is the same as selecting nothing
+		delete literals;
+		return;
+	}
+	selected_literals = literals;
+}
+
+bool Clause::selects(const Literal* literal) const
+{
+	return selected_literals != nullptr &&
+		std::find(selected_literals->begin(), selected_literals->end(),
+			literal) != selected_literals->end();
+}
@@ -2,7 +2,7 @@
 	File			: clause_index.cpp
 	Author			: Paul Gainer
 	Created			: 29/06/2014
-	Last modified	: 26/02/2015
+	Last modified	: 19/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -26,6 +26,7 @@
 \==============================================================================/
 <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 #include <algorithm>
+#include <climits>
 #include <iostream>
 #include <cstdarg>
 
@@ -45,6 +46,7 @@
 struct ClauseIndex::InternalNode
 {
 	int count = 0;
+	int passive_count = 0;
 	InternalNode** next_node = nullptr;
 };
 
@@ -68,11 +70,57 @@ ClauseIndex::ClauseIndex(const int F_COUNT, ...):
 	}
 	va_end(arguments);
 	root = buildNextLevel(0, nullptr);
+	// the second feature is the rank of the maximal literal
+	negated_left_leaves = new IndexNode*[max_feature_values[1]];
+	for(int i = 0; i < max_feature_values[1]; i++)
+	{
+		negated_left_leaves[i] = nullptr;
+	}
+	// the first feature is the clause type
+	selected_leaves = new IndexNode**[max_feature_values[0]];
+	for(int i = 0; i < max_feature_values[0]; i++)
+	{
+		selected_leaves[i] = new IndexNode*[max_feature_values[1]];
+		for(int j = 0; j < max_feature_values[1]; j++)
+		{
+			selected_leaves[i][j] = nullptr;
+		}
+	}
+	subsumer_cache = new Clause*[SUBSUMER_CACHE_SIZE];
 }
 
 
 ClauseIndex::~ClauseIndex()
 {
+	/* the clauses themselves are deleted along with the index tree, except
+	   for the dead clauses which are already in the archive */
+	for(int i = 0; i < max_feature_values[1]; i++)
+	{
+		IndexNode* node = negated_left_leaves[i];
+		while(node != nullptr)
+		{
+			IndexNode* temp = node;
+			node = node->next;
+			delete temp;
+		}
+	}
+	delete[] negated_left_leaves;
+	for(int i = 0; i < max_feature_values[0]; i++)
+	{
+		for(int j = 0; j < max_feature_values[1]; j++)
+		{
+			IndexNode* node = selected_leaves[i][j];
+			while(node != nullptr)
+			{
+				IndexNode* temp = node;
+				node = node->next;
+				delete temp;
+			}
+		}
+		delete[] selected_leaves[i];
+	}
+	delete[] selected_leaves;
+	delete[] subsumer_cache;
 	deleteNextLevel(0, root);
 	delete[] max_feature_values;
 }
@@ -82,42 +130,51 @@ ClauseIndex::~ClauseIndex()
 ==============================================================================*/
 void ClauseIndex::addToIndex(Clause* clause)
 {
-	int* feature_vector = clause->calculateFeatures();
-
-	InternalNode** node = root;
-	int i = 0;
-	// traverse the tree until the penultimate level is reached
-	while(i < feature_count - 2)
-	{
-		node[feature_vector[i]]->count++;
-		node = node[feature_vector[i]]->next_node;
-		i++;
-	}
-	node[feature_vector[i]]->count++;
-	InternalNodeTerminal* new_terminal_node =
-		static_cast<InternalNodeTerminal*>(node[feature_vector[i++]]);
-	int index = feature_vector[i];
-	IndexNode** leaves = new_terminal_node->leaves;
+	int index;
+	IndexNode** leaves = updateCounts(clause, 1, clause->saturated ? 0 : 1,
+		&index);
 	if(leaves[index] == nullptr)
 	{
-		// there was nothing stored here so start a new list
-		leaves[index] = new IndexNode(clause, nullptr, nullptr);
-		// update the maximum clause length if needed
+		// there was nothing stored here so update the maximum clause length
 		if(clause->size() > max_clause_length)
 		{
 			max_clause_length = clause->size();
 		}
 	}
-	else
+	clause->index_node = addToList(leaves, index, clause);
+	if((clause->clause_type == ClauseType::POSITIVE ||
+		clause->clause_type == ClauseType::NEGATIVE) && clause->left->size() > 0)
 	{
-		// store the clause in a new IndexNode at the start of the list
-		IndexNode* new_node = new IndexNode(clause, leaves[index], nullptr);
-		leaves[index]->prev = new_node;
-		leaves[index] = new_node;
+		/* store the coalition clause once for the complement of each literal
+		   in its conjunction */
+		clause->negated_left_nodes = new IndexNode*[clause->left->size()];
+		int j = 0;
+		std::for_each(clause->left->getList()->begin(),
+			clause->left->getList()->end(),
+			[&](Literal* l)
+			{
+				clause->negated_left_nodes[j++] = addToList(negated_left_leaves,
+					l->complementary_literal->rank, clause);
+			});
+	}
+	clause->selectLiterals(g_literal_selection);
+	if(clause->selected_literals != nullptr)
+	{
+		/* store the clause again for each literal it is resolved upon, other
+		   than its maximal literal which is already a feature of the clause */
+		clause->selected_nodes =
+			new IndexNode*[clause->selected_literals->size()];
+		Literal* max_literal = clause->right->getMaximalLiteral();
+		int j = 0;
+		std::for_each(clause->selected_literals->begin(),
+			clause->selected_literals->end(),
+			[&](Literal* l)
+			{
+				clause->selected_nodes[j++] = l == max_literal ? nullptr :
+					addToList(selected_leaves[clause->clause_type], l->rank,
+						clause);
+			});
 	}
-	clause->index_node = leaves[index];
-	num_clauses++;
-	delete[] feature_vector;
 }
 
 void ClauseIndex::removeFromIndex(Clause* clause)
@@ -127,61 +184,114 @@ void ClauseIndex::removeFromIndex(Clause* clause)
 		// the clause is not stored in an index so nothing to do here
 		return;
 	}
-	int* feature_vector = clause->calculateFeatures();
-	InternalNode** node = root;
-	int i = 0;
-	// traverse the tree until the penultimate level is reached
-	while(i < feature_count - 2)
+	// a dead clause is no longer counted so only unlink it
+	int index;
+	IndexNode** leaves = updateCounts(clause, clause->dead ? 0 : -1,
+		clause->dead || clause->saturated ? 0 : -1, &index);
+	removeFromList(leaves, index, clause->index_node);
+	clause->index_node = nullptr;
+	if(clause->negated_left_nodes != nullptr)
 	{
-		node[feature_vector[i]]->count--;
-		node = node[feature_vector[i]]->next_node;
-		i++;
+		int j = 0;
+		std::for_each(clause->left->getList()->begin(),
+			clause->left->getList()->end(),
+			[&](Literal* l)
+			{
+				removeFromList(negated_left_leaves,
+					l->complementary_literal->rank,
+					clause->negated_left_nodes[j++]);
+			});
+		delete[] clause->negated_left_nodes;
+		clause->negated_left_nodes = nullptr;
 	}
-	node[feature_vector[i]]->count--;
-	InternalNodeTerminal* new_terminal_node =
-		static_cast<InternalNodeTerminal*>(node[feature_vector[i++]]);
-	int index = feature_vector[i];
-	IndexNode** leaves = new_terminal_node->leaves;
-	IndexNode* prev = clause->index_node->prev;
-	IndexNode* next = clause->index_node->next;
-	if(prev == nullptr)
+	if(clause->selected_nodes != nullptr)
 	{
-		if(next == nullptr)
-		{
-			// the only node in the list
-			leaves[index] = nullptr;
-		}
-		else
-		{
-			// the first node in the list
-			next->prev = nullptr;
-			leaves[index] = next;
-		}
+		int j = 0;
+		std::for_each(clause->selected_literals->begin(),
+			clause->selected_literals->end(),
+			[&](Literal* l)
+			{
+				if(clause->selected_nodes[j] != nullptr)
+				{
+					removeFromList(selected_leaves[clause->clause_type],
+						l->rank, clause->selected_nodes[j]);
+				}
+				j++;
+			});
+		delete[] clause->selected_nodes;
+		clause->selected_nodes = nullptr;
 	}
-	else
+	uncacheSubsumer(clause);
+}
+
+void ClauseIndex::lazyRemoveFromIndex(Clause* clause)
+{
+	if(clause->index_node == nullptr || clause->dead)
 	{
-		if(next == nullptr)
+		// the clause is not stored in an index or is already dead
+		return;
+	}
+	int index;
+	updateCounts(clause, -1, clause->saturated ? 0 : -1, &index);
+	clause->dead = true;
+	uncacheSubsumer(clause);
+	dead_clauses.push_back(clause);
+	if(dead_clauses.size() * 100 >
+		(num_clauses + dead_clauses.size()) * DEAD_CLAUSE_COMPACTION_PERCENT)
+	{
+		// too many scans are passing over dead clauses
+		compactIndex();
+	}
+}
+
+void ClauseIndex::markSaturated(Clause* clause)
+{
+	if(clause->index_node == nullptr || clause->saturated || clause->dead)
+	{
+		// the clause is not stored in an index or is already saturated
+		return;
+	}
+	int index;
+	updateCounts(clause, 0, -1, &index);
+	clause->saturated = true;
+}
+
+void ClauseIndex::markUnsaturated(Clause* clause)
+{
+	if(clause->index_node == nullptr || !clause->saturated || clause->dead)
+	{
+		// the clause is not stored in an index or is already passive
+		return;
+	}
+	int index;
+	updateCounts(clause, 0, 1, &index);
+	clause->saturated = false;
+}
+
+std::list<Clause*>* ClauseIndex::getUnsupportedClauses()
+{
+	std::list<Clause*>* unsupported_clauses = new std::list<Clause*>();
+	displayNextFeature(root, 0, unsupported_clauses);
+	unsupported_clauses->remove_if([](Clause* clause)
 		{
-			// the last node in the list
-			prev->next = nullptr;
-		}
-		else
+			return !clause->saturated || clause->dead || clause->supported;
+		});
+	unsupported_clauses->sort([](Clause* this_clause, Clause* that_clause)
 		{
-			// in between two nodes in the list
-			prev->next = next;
-			next->prev = prev;
-		}
-	}
-	delete clause->index_node;
-	clause->index_node = nullptr;
-	num_clauses--;
-	delete[] feature_vector;
+			return this_clause->identifier < that_clause->identifier;
+		});
+	return unsupported_clauses;
 }
 
 void ClauseIndex::displayIndex()
 {
 	std::list<Clause*>* all_clauses = new std::list<Clause*>();
 	displayNextFeature(root, 0, all_clauses);
+	// passive and dead clauses are not displayed
+	all_clauses->remove_if([](Clause* clause)
+		{
+			return !clause->saturated || clause->dead;
+		});
 	// sort all of the clauses by identifier...
 	all_clauses->sort([](Clause* this_clause, Clause* that_clause)
 		{
@@ -272,11 +382,104 @@ std::list<IndexNode*>* ClauseIndex::filterByMinLiteralAndLength(
 	return new_clause_list;
 }
 
+std::list<IndexNode*>* ClauseIndex::filterByNegatedLeft(Clause* clause,
+	int rank, int length)
+{
+	std::list<IndexNode*>* new_clause_list = new std::list<IndexNode*>();
+	int left_size = clause->left->size();
+	if(left_size == 0 || root[ClauseType::UNIVERSAL]->count == 0)
+	{
+		// there is nothing to retrieve
+		return new_clause_list;
+	}
+	int* feature_vector = new int[3] {ClauseType::UNIVERSAL, -1, -1};
+	std::for_each(clause->left->getList()->begin(),
+		clause->left->getList()->end(),
+		[&](Literal* l)
+		{
+			feature_vector[1] = l->complementary_literal->rank;
+			for(int i = 1; i <= left_size && i <= max_clause_length; i++)
+			{
+				// skip the clauses that have already been retrieved
+				if(feature_vector[1] > rank || i > length)
+				{
+					feature_vector[2] = i;
+					getClauseList(feature_vector, new_clause_list);
+				}
+			}
+		});
+	delete[] feature_vector;
+	return new_clause_list;
+}
+
+std::list<IndexNode*>* ClauseIndex::filterByNegatedLeftLiteral(int rank)
+{
+	std::list<IndexNode*>* new_clause_list = new std::list<IndexNode*>();
+	if(negated_left_leaves[rank] != nullptr)
+	{
+		new_clause_list->push_back(negated_left_leaves[rank]);
+	}
+	return new_clause_list;
+}
+
+std::list<IndexNode*>* ClauseIndex::filterByResolutionLiteral(int rank,
+	std::list<ClauseType>* clause_types)
+{
+	std::list<IndexNode*> selected_clause_list;
+	std::for_each(clause_types->begin(), clause_types->end(),
+		[&](ClauseType type)
+		{
+			if(selected_leaves[type][rank] != nullptr)
+			{
+				selected_clause_list.push_back(selected_leaves[type][rank]);
+			}
+		});
+	// the clause types are deleted here
+	std::list<IndexNode*>* new_clause_list =
+		filterByMaxLiteral(rank, clause_types);
+	new_clause_list->splice(new_clause_list->end(), selected_clause_list);
+	return new_clause_list;
+}
+
+Clause* ClauseIndex::findCachedSubsumer(Clause* clause)
+{
+	for(int i = 0; i < subsumer_cache_count; i++)
+	{
+		Clause* subsumer = subsumer_cache[i];
+		if(subsumer->mayForwardSubsume(clause) && subsumer->subsumes(clause))
+		{
+			// move the subsumer to the front of the cache
+			std::copy_backward(subsumer_cache, subsumer_cache + i,
+				subsumer_cache + i + 1);
+			subsumer_cache[0] = subsumer;
+			return subsumer;
+		}
+	}
+	return nullptr;
+}
+
+void ClauseIndex::cacheSubsumer(Clause* clause)
+{
+	Clause** cache_end = subsumer_cache + subsumer_cache_count;
+	Clause** cache_it = std::find(subsumer_cache, cache_end, clause);
+	if(cache_it == cache_end)
+	{
+		// the clause is not cached so make room for it, evicting the last one
+		if(subsumer_cache_count < SUBSUMER_CACHE_SIZE)
+		{
+			subsumer_cache_count++;
+		}
+		cache_it = subsumer_cache + subsumer_cache_count - 1;
+	}
+	std::copy_backward(subsumer_cache, cache_it, cache_it + 1);
+	subsumer_cache[0] = clause;
+}
+
 Clause* ClauseIndex::getNextSmallestClause()
 {
-	if(num_clauses == 0)
+	if(num_passive_clauses == 0)
 	{
-		// the index is empty
+		// there are no passive clauses in the index
 		return nullptr;
 	}
 	std::list<IndexNode*>* clauses = new std::list<IndexNode*>();
@@ -286,22 +489,31 @@ Clause* ClauseIndex::getNextSmallestClause()
 	{
 		for(int j = 0; j < 4; j++)
 		{
-			if(root[j]->count > 0)
+			if(root[j]->passive_count > 0)
 			{
 				for(int k = 1; k <= num_literals; k++)
 				{
-					if(root[j]->next_node[k]->count > 0)
+					if(root[j]->next_node[k]->passive_count > 0)
 					{
 						int* feature_vector = new int[3] {j, k, i};
 						getClauseList(feature_vector, clauses);
-						if(clauses->size() > 0)
+						// skip any saturated or dead clauses that were retrieved
+						IndexNode* node = clauses->empty() ? nullptr :
+							clauses->front();
+						while(node != nullptr &&
+							(node->clause->saturated || node->clause->dead))
+						{
+							node = node->next;
+						}
+						if(node != nullptr)
 						{
-							// clauses were retrieved so return the first one
-							Clause* c = clauses->front()->clause;
+							// return the first passive clause retrieved
+							Clause* c = node->clause;
 							delete[] feature_vector;
 							delete clauses;
 							return c;
 						}
+						clauses->clear();
 						delete[] feature_vector;
 					}
 				}
@@ -315,23 +527,140 @@ Clause* ClauseIndex::getNextSmallestClause()
 std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 {
 	std::list<Clause*>* resolved_clauses = new std::list<Clause*>();
+	// duplicates are only detected within this batch of resolvents
+	batch_resolvents.clear();
+	if(g_hyperresolution && (clause->clause_type == ClauseType::INITIAL ||
+		clause->clause_type == ClauseType::UNIVERSAL))
+	{
+		/* universal and initial clauses are only resolved with each other
+		   by hyperresolution */
+		if(hyperresolve(clause, resolved_clauses))
+		{
+			return resolved_clauses;
+		}
+	}
+	if(clause->selected_literals == nullptr)
+	{
+		resolveUpon(clause, clause->right->getMaximalLiteral(),
+			resolved_clauses);
+	}
+	else
+	{
+		std::find_if(clause->selected_literals->begin(),
+			clause->selected_literals->end(), [&](Literal* l)
+			{
+				// stop once a contradiction has been derived
+				return resolveUpon(clause, l, resolved_clauses);
+			});
+	}
+	return resolved_clauses;
+}
+
+/*==============================================================================
+	Private Functions
+==============================================================================*/
+ClauseIndex::InternalNode** ClauseIndex::buildNextLevel(int feature,
+	InternalNode* previous_node)
+{
+	InternalNode** this_node =
+		new InternalNode*[max_feature_values[feature]];
+	if(feature == feature_count - 2)
+	{
+		// this is the penultimate level so build the final level of internal
+		// nodes
+		for(int i = 0; i < max_feature_values[feature]; i++)
+		{
+			InternalNodeTerminal* new_terminal_node = new InternalNodeTerminal;
+			IndexNode** index_node_array =
+				new IndexNode*[max_feature_values[feature + 1]];
+			// build the last level of leaf nodes
+			for(int j = 0; j < max_feature_values[feature + 1]; j++)
+			{
+				index_node_array[j] = nullptr;
+			}
+			new_terminal_node->leaves = index_node_array;
+			this_node[i] = new_terminal_node;
+		}
+	}
+	else
+	{
+		// build the next level of nodes
+		for(int i = 0; i < max_feature_values[feature]; i++)
+		{
+			InternalNode* new_node = new InternalNode;
+			new_node->next_node = buildNextLevel(feature + 1, this_node[i]);
+			this_node[i] = new_node;
+		}
+	}
+	return this_node;
+}
+
+void ClauseIndex::deleteNextLevel(int feature, InternalNode** node)
+{
+	if(feature == feature_count - 2)
+	{
+		// this is the penultimate level so remove the final level of internal
+		// nodes
+		for(int i = 0; i < max_feature_values[feature]; i++)
+		{
+			InternalNodeTerminal* terminal_node =
+				static_cast<InternalNodeTerminal*>(node[i]);
+			IndexNode** leaves = terminal_node->leaves;
+			// remove the level of leaf nodes
+			for(int j = 0; j < max_feature_values[feature_count - 1]; j++)
+			{
+				IndexNode* node = leaves[j];
+				if(node != nullptr)
+				{
+					while(node != nullptr)
+					{
+						IndexNode* temp = node;
+						node = node->next;
+						if(!temp->clause->dead)
+						{
+							delete temp->clause;
+						}
+						delete temp;
+					}
+				}
+			}
+			delete[] leaves;
+			delete node[i];
+		}
+		delete[] node;
+	}
+	else
+	{
+		// remove the next level of nodes
+		for(int i = 0; i < max_feature_values[feature]; i++)
+		{
+			deleteNextLevel(feature + 1, node[i]->next_node);
+			delete node[i];
+		}
+		delete[] node;
+	}
+}
+
+bool ClauseIndex::resolveUpon(Clause* clause, Literal* resolved_literal,
+	std::list<Clause*>* resolved_clauses)
+{
 	std::list<IndexNode*>* filtered_clauses = nullptr;
 	std::list<IndexNode*>::iterator filtered_it;
 	std::list<IndexNode*>::iterator filtered_end;
-	Literal* max_literal = clause->right->getMaximalLiteral();
 	std::list<ClauseType>* clause_types = new std::list<ClauseType>();
-	Clause* resolvent;
 
 	switch(clause->clause_type)
 	{
 	case ClauseType::INITIAL:
-		clause_types->push_back(ClauseType::INITIAL);
-		clause_types->push_back(ClauseType::UNIVERSAL);
-		// get all the clauses having as maximal literal the complement of
-		// the maximal literal of the given clause
-		filtered_clauses =
-			filterByMaxLiteral(max_literal->complementary_literal->rank,
-				clause_types);
+		if(!g_hyperresolution)
+		{
+			clause_types->push_back(ClauseType::INITIAL);
+			clause_types->push_back(ClauseType::UNIVERSAL);
+		}
+		// get all the clauses resolved upon the complement of the literal
+		// the given clause is resolved upon
+		filtered_clauses = filterByResolutionLiteral(
+			resolved_literal->complementary_literal->rank, clause_types);
 		filtered_it = filtered_clauses->begin();
 		filtered_end = filtered_clauses->end();
 		while(filtered_it != filtered_end)
@@ -340,30 +669,28 @@ std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 			while(node != nullptr)
 			{
 				Clause* index_clause = node->clause;
-				std::pair<LiteralList*, const bool>* pair =
-					LiteralList::unionLiterals(
-						clause->right->removeMaximalLiteral(),
-						index_clause->right->removeMaximalLiteral());
-				if(!pair->second)
+				if(!mayResolve(clause, index_clause,
+					resolved_literal->complementary_literal))
+				{
+					/* passive clauses are only resolved with once selected,
+					   dead clauses and unsupported pairs never */
+					node = node->next;
+					continue;
+				}
+				if(!LiteralList::resolvedUnion(clause->right, resolved_literal,
+					index_clause->right,
+					resolved_literal->complementary_literal,
+					resolvent_literals))
 				{
 					// IRES1 has been applied
 					g_inference_count_ires1++;
-					resolvent = new Clause(new LiteralList(),
-						new std::list<int>(), pair->first, ClauseType::INITIAL,
-						new Justification(clause->identifier,
-							index_clause->identifier, max_literal,
-							InferenceRule::IRES1), nullptr);
-					if(resolvent->size() == 0)
+					if(addResolvent(ClauseType::INITIAL, nullptr, nullptr,
+						nullptr, false, clause, index_clause, resolved_literal,
+						InferenceRule::IRES1, resolved_clauses))
 					{
 						// a contradiction has been derived
-						g_contradiction = resolvent;
-						delete pair;
 						delete filtered_clauses;
-						return resolved_clauses;
-					}
-					else
-					{
-						resolved_clauses->push_back(resolvent);
+						return true;
 					}
 				}
 				else
@@ -374,9 +701,7 @@ std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 					{
 						displayTautology(clause, index_clause);
 					}
-					delete pair->first;
 				}
-				delete pair;
 				node = node->next;
 			}
 			filtered_it++;
@@ -384,15 +709,17 @@ std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 		break;
 
 	case ClauseType::UNIVERSAL:
-		clause_types->push_back(ClauseType::INITIAL);
-		clause_types->push_back(ClauseType::UNIVERSAL);
+		if(!g_hyperresolution)
+		{
+			clause_types->push_back(ClauseType::INITIAL);
+			clause_types->push_back(ClauseType::UNIVERSAL);
+		}
 		clause_types->push_back(ClauseType::POSITIVE);
 		clause_types->push_back(ClauseType::NEGATIVE);
-		// get all the clauses having as maximal literal the complement of
-		// the maximal literal of the given clause
-		filtered_clauses =
-			filterByMaxLiteral(max_literal->complementary_literal->rank,
-				clause_types);
+		// get all the clauses resolved upon the complement of the literal
+		// the given clause is resolved upon
+		filtered_clauses = filterByResolutionLiteral(
+			resolved_literal->complementary_literal->rank, clause_types);
 		filtered_it = filtered_clauses->begin();
 		filtered_end = filtered_clauses->end();
 		while(filtered_it != filtered_end)
@@ -401,109 +728,76 @@ std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 			while(node != nullptr)
 			{
 				Clause* index_clause = node->clause;
-				std::pair<LiteralList*, const bool>* pair =
-					LiteralList::unionLiterals(
-						clause->right->removeMaximalLiteral(),
-						index_clause->right->removeMaximalLiteral());
-				if(!pair->second)
+				if(!mayResolve(clause, index_clause,
+					resolved_literal->complementary_literal))
+				{
+					/* passive clauses are only resolved with once selected,
+					   dead clauses and unsupported pairs never */
+					node = node->next;
+					continue;
+				}
+				if(!LiteralList::resolvedUnion(clause->right, resolved_literal,
+					index_clause->right,
+					resolved_literal->complementary_literal,
+					resolvent_literals))
 				{
 					switch(index_clause->clause_type)
 					{
 					case ClauseType::INITIAL:
 						// IRES1 has been applied
 						g_inference_count_ires1++;
-						resolvent = new Clause(
-							new LiteralList(), new std::list<int>(),
-							pair->first, ClauseType::INITIAL,
-							new Justification(clause->identifier,
-								index_clause->identifier, max_literal,
-								InferenceRule::IRES1), nullptr);
-						if(resolvent->size() == 0)
-						{
-							// a contradiction has been derived
-							g_contradiction = resolvent;
-							delete pair;
-							delete filtered_clauses;
-							return resolved_clauses;
-						}
-						else
+						if(addResolvent(ClauseType::INITIAL, nullptr, nullptr,
+							nullptr, false, clause, index_clause,
+							resolved_literal, InferenceRule::IRES1,
+							resolved_clauses))
 						{
-							resolved_clauses->push_back(resolvent);
+							// a contradiction has been derived
+							delete filtered_clauses;
+							return true;
 						}
 						break;
 
 					case ClauseType::UNIVERSAL:
 						// GRES1 has been applied
 						g_inference_count_gres1++;
-						resolvent = new Clause(
-							new LiteralList(), new std::list<int>(),
-							pair->first, ClauseType::UNIVERSAL,
-							new Justification(clause->identifier,
-								index_clause->identifier, max_literal,
-								InferenceRule::GRES1), nullptr);
-						if(resolvent->size() == 0)
+						if(addResolvent(ClauseType::UNIVERSAL, nullptr, nullptr,
+							nullptr, false, clause, index_clause,
+							resolved_literal, InferenceRule::GRES1,
+							resolved_clauses))
 						{
 							// a contradiction has been derived
-							g_contradiction = resolvent;
-							delete pair;
 							delete filtered_clauses;
-							return resolved_clauses;
-						}
-						else
-						{
-							resolved_clauses->push_back(resolvent);
+							return true;
 						}
 						break;
 
 					case ClauseType::POSITIVE:
 						// CRES2 has been applied
 						g_inference_count_cres2++;
-						resolvent = new Clause(
-							new LiteralList(*(index_clause->left)),
-							new std::list<int>(*(index_clause->agents)),
-							pair->first, ClauseType::POSITIVE,
-							new Justification(clause->identifier,
-								index_clause->identifier, max_literal,
-								InferenceRule::CRES2),
-							new std::vector<int>(
-								*(index_clause->coalition_vector)));
-						if(resolvent->size() == 0)
+						if(addResolvent(ClauseType::POSITIVE,
+							index_clause->left, index_clause->agents,
+							index_clause->coalition_vector, true, clause,
+							index_clause, resolved_literal,
+							InferenceRule::CRES2, resolved_clauses))
 						{
 							// a contradiction has been derived
-							g_contradiction = resolvent;
-							delete pair;
 							delete filtered_clauses;
-							return resolved_clauses;
-						}
-						else
-						{
-							resolved_clauses->push_back(resolvent);
+							return true;
 						}
 						break;
 
 					case ClauseType::NEGATIVE:
 						// CRES4 has been applied
 						g_inference_count_cres4++;
-						resolvent = new Clause(
-							new LiteralList(*(index_clause->left)),
-							new std::list<int>(*(index_clause->agents)),
-							pair->first, ClauseType::NEGATIVE,
-							new Justification(clause->identifier,
-								index_clause->identifier, max_literal,
-								InferenceRule::CRES4),
-							new std::vector<int>(
-								*(index_clause->coalition_vector)));
-						if(resolvent->size() == 0)
+						if(addResolvent(ClauseType::NEGATIVE,
+							index_clause->left, index_clause->agents,
+							index_clause->coalition_vector, true, clause,
+							index_clause, resolved_literal,
+							InferenceRule::CRES4, resolved_clauses))
 						{
 							// a contradiction has been derived
-							g_contradiction = resolvent;
-							delete pair;
 							delete filtered_clauses;
-							return resolved_clauses;
-						}
-						else
-						{
-							resolved_clauses->push_back(resolvent);
+							return true;
 						}
 						break;
 
@@ -519,9 +813,7 @@ std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 					{
 						displayTautology(clause, index_clause);
 					}
-					delete pair->first;
 				}
-				delete pair;
 				node = node->next;
 			}
 			filtered_it++;
@@ -532,11 +824,10 @@ std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 		clause_types->push_back(ClauseType::UNIVERSAL);
 		clause_types->push_back(ClauseType::POSITIVE);
 		clause_types->push_back(ClauseType::NEGATIVE);
-		filtered_clauses =
-			filterByMaxLiteral(max_literal->complementary_literal->rank,
-				clause_types);
-		// get all the clauses having as maximal literal the complement of
-		// the maximal literal of the given clause
+		filtered_clauses = filterByResolutionLiteral(
+			resolved_literal->complementary_literal->rank, clause_types);
+		// get all the clauses resolved upon the complement of the literal
+		// the given clause is resolved upon
 		filtered_it = filtered_clauses->begin();
 		filtered_end = filtered_clauses->end();
 		while(filtered_it != filtered_end)
@@ -545,11 +836,27 @@ std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 			while(node != nullptr)
 			{
 				Clause* index_clause = node->clause;
-				std::pair<LiteralList*, const bool>* pair =
-					LiteralList::unionLiterals(
-						clause->right->removeMaximalLiteral(),
-						index_clause->right->removeMaximalLiteral());
-				if(!pair->second)
+				if(!mayResolve(clause, index_clause,
+					resolved_literal->complementary_literal))
+				{
+					/* passive clauses are only resolved with once selected,
+					   dead clauses and unsupported pairs never */
+					node = node->next;
+					continue;
+				}
+				if(index_clause->clause_type != ClauseType::UNIVERSAL &&
+					!clause->mayMergeCoalitions(index_clause))
+				{
+					/* the coalition vectors cannot be merged so there is no
+					   need to look at the literals */
+					g_coalition_merges_skipped++;
+					node = node->next;
+					continue;
+				}
+				if(!LiteralList::resolvedUnion(clause->right, resolved_literal,
+					index_clause->right,
+					resolved_literal->complementary_literal,
+					resolvent_literals))
 				{
 					if(index_clause->clause_type == ClauseType::UNIVERSAL)
 					{
@@ -557,54 +864,28 @@ std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 						{
 							// CRES2 has been applied
 							g_inference_count_cres2++;
-							resolvent =	new Clause(
-								new LiteralList(*(clause->left)),
-								new std::list<int>(*clause->agents),
-								pair->first,
-								ClauseType::POSITIVE,
-								new Justification(clause->identifier,
-									index_clause->identifier, max_literal,
-									InferenceRule::CRES2),
-								new std::vector<int>(*(
-									clause->coalition_vector)));
-							if(resolvent->size() == 0)
+							if(addResolvent(ClauseType::POSITIVE, clause->left,
+								clause->agents, clause->coalition_vector, true,
+								clause, index_clause, resolved_literal,
+								InferenceRule::CRES2, resolved_clauses))
 							{
 								// a contradiction has been derived
-								g_contradiction = resolvent;
-								delete pair;
 								delete filtered_clauses;
-								return resolved_clauses;
-							}
-							else
-							{
-								resolved_clauses->push_back(resolvent);
+								return true;
 							}
 						}
 						else
 						{
 							// CRES2 has been applied
 							g_inference_count_cres2++;
-							resolvent = new Clause(
-								new LiteralList(*(clause->left)),
-								new std::list<int>(*clause->agents),
-								pair->first,
-								ClauseType::NEGATIVE,
-								new Justification(clause->identifier,
-									index_clause->identifier, max_literal,
-									InferenceRule::CRES4),
-								new std::vector<int>(
-									*(clause->coalition_vector)));
-							if(resolvent->size() == 0)
+							if(addResolvent(ClauseType::NEGATIVE, clause->left,
+								clause->agents, clause->coalition_vector, true,
+								clause, index_clause, resolved_literal,
+								InferenceRule::CRES4, resolved_clauses))
 							{
 								// a contradiction has been derived
-								g_contradiction = resolvent;
-								delete pair;
 								delete filtered_clauses;
-								return resolved_clauses;
-							}
-							else
-							{
-								resolved_clauses->push_back(resolvent);
+								return true;
 							}
 						}
 					}
@@ -627,62 +908,40 @@ std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 									{
 										// CRES1 has been applied
 										g_inference_count_cres1++;
-										resolvent = new Clause(
-											pair_left->first,
-											clause->unionAgents(index_clause),
-											pair->first, ClauseType::POSITIVE,
-											new Justification(
-												clause->identifier,
-												index_clause->identifier,
-												max_literal,
-												InferenceRule::CRES1),
-											pair_agents->first);
-										if(resolvent->size() == 0)
+										std::list<int>* agents =
+											clause->unionAgents(index_clause);
+										if(addResolvent(ClauseType::POSITIVE,
+											pair_left->first, agents,
+											pair_agents->first, false, clause,
+											index_clause, resolved_literal,
+											InferenceRule::CRES1,
+											resolved_clauses))
 										{
 											// a contradiction has been derived
-											g_contradiction = resolvent;
 											delete pair_agents;
 											delete pair_left;
-											delete pair;
 											delete filtered_clauses;
-											return resolved_clauses;
-										}
-										else
-										{
-											resolved_clauses->push_back(
-												resolvent);
+											return true;
 										}
 									}
 									else
 									{
 										// CRES3 has been applied
 										g_inference_count_cres3++;
-										resolvent = new Clause(
-											pair_left->first,
-											index_clause->
-												relativeComplementAgents(clause),
-											pair->first,
-											ClauseType::NEGATIVE,
-											new Justification(
-												clause->identifier,
-												index_clause->identifier,
-												max_literal,
-												InferenceRule::CRES3),
-											pair_agents->first);
-										if(resolvent->size() == 0)
+										std::list<int>* agents =
+											index_clause->relativeComplementAgents(clause);
+										if(addResolvent(ClauseType::NEGATIVE,
+											pair_left->first, agents,
+											pair_agents->first, false, clause,
+											index_clause, resolved_literal,
+											InferenceRule::CRES3,
+											resolved_clauses))
 										{
 											// a contradiction has been derived
-											g_contradiction = resolvent;
 											delete pair_agents;
 											delete pair_left;
-											delete pair;
 											delete filtered_clauses;
-											return resolved_clauses;
-										}
-										else
-										{
-											resolved_clauses->push_back(
-												resolvent);
+											return true;
 										}
 									}
 								}
@@ -693,69 +952,46 @@ std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 									{
 										// CRES3 has been applied
 										g_inference_count_cres3++;
-										resolvent = new Clause(
-										pair_left->first,
-										clause->relativeComplementAgents(
-											index_clause),pair->first,
-											ClauseType::NEGATIVE,
-											new Justification(
-												clause->identifier,
-												index_clause->identifier,
-												max_literal,
-												InferenceRule::CRES3),
-											pair_agents->first);
-										if(resolvent->size() == 0)
+										std::list<int>* agents =
+											clause->relativeComplementAgents(index_clause);
+										if(addResolvent(ClauseType::NEGATIVE,
+											pair_left->first, agents,
+											pair_agents->first, false, clause,
+											index_clause, resolved_literal,
+											InferenceRule::CRES3,
+											resolved_clauses))
 										{
 											// a contradiction has been derived
-											g_contradiction = resolvent;
 											delete pair_agents;
 											delete pair_left;
-											delete pair;
 											delete filtered_clauses;
-											return resolved_clauses;
-										}
-										else
-										{
-											resolved_clauses->push_back(
-												resolvent);
+											return true;
 										}
 									}
 									else
 									{
 										// CRES5 has been applied
 										g_inference_count_cres5++;
-										resolvent = new Clause(
-											pair_left->first,
-											clause->intersectionAgents(
-												index_clause),
-											pair->first,
-											ClauseType::NEGATIVE,
-											new Justification(
-												clause->identifier,
-												index_clause->identifier,
-												max_literal,
-												InferenceRule::CRES5),
-											pair_agents->first);
-										if(resolvent->size() == 0)
+										std::list<int>* agents =
+											clause->intersectionAgents(index_clause);
+										if(addResolvent(ClauseType::NEGATIVE,
+											pair_left->first, agents,
+											pair_agents->first, false, clause,
+											index_clause, resolved_literal,
+											InferenceRule::CRES5,
+											resolved_clauses))
 										{
 											// a contradiction has been derived
-											g_contradiction = resolvent;
 											delete pair_agents;
 											delete pair_left;
-											delete pair;
 											delete filtered_clauses;
-											return resolved_clauses;
-										}
-										else
-										{
-											resolved_clauses->push_back(resolvent);
+											return true;
 										}
 									}
 								}
 							}
 							else
 							{
-								delete pair->first;
 								delete pair_left->first;
 								delete pair_agents->first;
 							}
@@ -770,7 +1006,6 @@ std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 								displayTautology(clause, index_clause);
 							}
 
-							delete pair->first;
 							delete pair_left->first;
 						}
 						delete pair_left;
@@ -784,9 +1019,7 @@ std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 					{
 						displayTautology(clause, index_clause);
 					}
-					delete pair->first;
 				}
-				delete pair;
 				node = node->next;
 			}
 			filtered_it++;
@@ -798,88 +1031,306 @@ std::list<Clause*>* ClauseIndex::resolve(Clause* clause)
 	}
 
 	delete filtered_clauses;
-	return resolved_clauses;
+	return false;
 }
 
-/*==============================================================================
-	Private Functions
-==============================================================================*/
-ClauseIndex::InternalNode** ClauseIndex::buildNextLevel(int feature,
-	InternalNode* previous_node)
+bool ClauseIndex::mayResolve(Clause* clause, Clause* index_clause,
+	Literal* literal)
 {
-	InternalNode** this_node =
-		new InternalNode*[max_feature_values[feature]];
-	if(feature == feature_count - 2)
+	if(!index_clause->saturated || index_clause->dead)
 	{
-		// this is the penultimate level so build the final level of internal
-		// nodes
-		for(int i = 0; i < max_feature_values[feature]; i++)
-		{
-			InternalNodeTerminal* new_terminal_node = new InternalNodeTerminal;
-			IndexNode** index_node_array =
-				new IndexNode*[max_feature_values[feature + 1]];
-			// build the last level of leaf nodes
-			for(int j = 0; j < max_feature_values[feature + 1]; j++)
-			{
-				index_node_array[j] = nullptr;
-			}
-			new_terminal_node->leaves = index_node_array;
-			this_node[i] = new_terminal_node;
-		}
+		return false;
 	}
-	else
+	if(index_clause->selected_literals != nullptr &&
+		!index_clause->selects(literal))
 	{
-		// build the next level of nodes
-		for(int i = 0; i < max_feature_values[feature]; i++)
+		/* the stored clause was retrieved by its maximal literal but is only
+		   resolved upon its selected literals */
+		return false;
+	}
+	if(!clause->supported && !index_clause->supported)
+	{
+		// neither clause is in the set of support
+		g_sos_skipped_partners++;
+		return false;
+	}
+	return true;
+}
+
+bool ClauseIndex::hyperresolve(Clause* clause,
+	std::list<Clause*>* resolved_clauses)
+{
+	Literal* max_literal = clause->right->getMaximalLiteral();
+	if(clause->selected_literals != nullptr || !max_literal->polarity)
+	{
+		// the clause is a nucleus
+		return resolveNucleus(clause, nullptr, resolved_clauses);
+	}
+	/* the clause is a positive satellite for every nucleus selecting the
+	   complement of its maximal literal */
+	Literal* literal = max_literal->complementary_literal;
+	std::list<IndexNode*>* filtered_clauses = filterByResolutionLiteral(
+		literal->rank, new std::list<ClauseType>
+			{ClauseType::INITIAL, ClauseType::UNIVERSAL});
+	std::list<IndexNode*>::iterator filtered_it = filtered_clauses->begin();
+	std::list<IndexNode*>::iterator filtered_end = filtered_clauses->end();
+	while(filtered_it != filtered_end)
+	{
+		IndexNode* node = *filtered_it;
+		while(node != nullptr)
 		{
-			InternalNode* new_node = new InternalNode;
-			new_node->next_node = buildNextLevel(feature + 1, this_node[i]);
-			this_node[i] = new_node;
+			Clause* nucleus = node->clause;
+			if(nucleus->saturated && !nucleus->dead &&
+				(nucleus->selected_literals == nullptr ||
+				nucleus->selects(literal)) &&
+				resolveNucleus(nucleus, clause, resolved_clauses))
+			{
+				delete filtered_clauses;
+				return true;
+			}
+			node = node->next;
 		}
+		filtered_it++;
 	}
-	return this_node;
+	delete filtered_clauses;
+	return false;
 }
 
-void ClauseIndex::deleteNextLevel(int feature, InternalNode** node)
+bool ClauseIndex::resolveNucleus(Clause* nucleus, Clause* satellite,
+	std::list<Clause*>* resolved_clauses)
 {
-	if(feature == feature_count - 2)
+	std::vector<Literal*> literals;
+	if(nucleus->selected_literals != nullptr)
 	{
-		// this is the penultimate level so remove the final level of internal
-		// nodes
-		for(int i = 0; i < max_feature_values[feature]; i++)
+		literals = *(nucleus->selected_literals);
+	}
+	else
+	{
+		// the only negative literal of the nucleus is its maximal literal
+		literals.push_back(nucleus->right->getMaximalLiteral());
+	}
+	// the disjunction of the nucleus without the literals resolved upon
+	LiteralList* remainder = new LiteralList(*(nucleus->right));
+	// the candidate satellites for each literal resolved upon
+	std::vector<std::vector<Clause*>> satellites(literals.size());
+	for(unsigned int i = 0; i < literals.size(); i++)
+	{
+		Literal* literal = literals[i]->complementary_literal;
+		LiteralList* temp = remainder->removeLiteral(literals[i]);
+		delete remainder;
+		remainder = temp;
+		if(satellite != nullptr &&
+			satellite->right->getMaximalLiteral() == literal)
 		{
-			InternalNodeTerminal* terminal_node =
-				static_cast<InternalNodeTerminal*>(node[i]);
-			IndexNode** leaves = terminal_node->leaves;
-			// remove the level of leaf nodes
-			for(int j = 0; j < max_feature_values[feature_count - 1]; j++)
+			satellites[i].push_back(satellite);
+			continue;
+		}
+		std::list<IndexNode*>* filtered_clauses = filterByMaxLiteral(
+			literal->rank, new std::list<ClauseType>
+				{ClauseType::INITIAL, ClauseType::UNIVERSAL});
+		std::for_each(filtered_clauses->begin(), filtered_clauses->end(),
+			[&](IndexNode* node)
 			{
-				IndexNode* node = leaves[j];
-				if(node != nullptr)
+				for(; node != nullptr; node = node->next)
 				{
-					while(node != nullptr)
+					Clause* c = node->clause;
+					if(c->saturated && !c->dead &&
+						c->selected_literals == nullptr)
 					{
-						IndexNode* temp = node;
-						node = node->next;
-						delete temp->clause;
-						delete temp;
+						satellites[i].push_back(c);
 					}
 				}
-			}
-			delete[] leaves;
-			delete node[i];
+			});
+		delete filtered_clauses;
+		if(satellites[i].empty())
+		{
+			// a literal cannot be resolved upon so there is no hyperresolvent
+			delete remainder;
+			return false;
 		}
-		delete[] node;
 	}
-	else
+	// extend the remainder with one satellite for each literal in turn
+	std::vector<int> premises;
+	bool contradiction = extendHyperresolvent(nucleus, satellites, 0,
+		remainder, premises, nucleus->supported,
+		nucleus->clause_type == ClauseType::INITIAL, resolved_clauses);
+	delete remainder;
+	return contradiction;
+}
+
+bool ClauseIndex::extendHyperresolvent(Clause* nucleus,
+	const std::vector<std::vector<Clause*>>& satellites, unsigned int position,
+	LiteralList* partial, std::vector<int>& premises, bool supported,
+	bool initial, std::list<Clause*>* resolved_clauses)
+{
+	ClauseType type = initial ? ClauseType::INITIAL : ClauseType::UNIVERSAL;
+	if(position == satellites.size())
 	{
-		// remove the next level of nodes
-		for(int i = 0; i < max_feature_values[feature]; i++)
+		if(!supported)
 		{
-			deleteNextLevel(feature + 1, node[i]->next_node);
-			delete node[i];
+			// none of the premises is in the set of support
+			g_sos_skipped_partners++;
+			return false;
 		}
-		delete[] node;
+		// HRES has been applied
+		g_inference_count_hres++;
+		resolvent_literals.clear();
+		if(partial->getList() != nullptr)
+		{
+			resolvent_literals.assign(partial->getList()->begin(),
+				partial->getList()->end());
+		}
+		if(isDuplicateResolvent(type, nullptr, nullptr, resolvent_literals,
+			nullptr))
+		{
+			// this resolvent has already been derived
+			return false;
+		}
+		bool checked = false;
+		if(isForwardSubsumedResolvent(type, &checked))
+		{
+			return false;
+		}
+		Clause* resolvent = new Clause(new LiteralList(), new std::list<int>(),
+			new LiteralList(resolvent_literals), type,
+			new Justification(nucleus->identifier,
+				new std::vector<int>(premises), InferenceRule::HRES),
+			nullptr, false);
+		if(checked)
+		{
+			resolvent->subsumption_checked_index = this;
+		}
+		if(resolvent->size() == 0)
+		{
+			// a contradiction has been derived
+			g_contradiction = resolvent;
+			return true;
+		}
+		resolved_clauses->push_back(resolvent);
+		return false;
+	}
+	resolvent_literals.clear();
+	if(partial->getList() != nullptr)
+	{
+		resolvent_literals.assign(partial->getList()->begin(),
+			partial->getList()->end());
+	}
+	if(g_forward_subsumption && isSubsumedDisjunction(type, resolvent_literals))
+	{
+		/* every hyperresolvent extending this one would be forward subsumed,
+		   so none of them are derived */
+		g_hres_subsumed_partials++;
+		return false;
+	}
+	for(unsigned int i = 0; i < satellites[position].size(); i++)
+	{
+		Clause* s = satellites[position][i];
+		std::pair<LiteralList*, const bool>* pair =
+			LiteralList::unionLiterals(new LiteralList(*partial),
+				s->right->removeMaximalLiteral());
+		LiteralList* extended = pair->first;
+		bool tautology = pair->second;
+		delete pair;
+		if(tautology)
+		{
+			// every hyperresolvent extending this one is a tautology
+			g_inference_count_tautology++;
+			delete extended;
+			continue;
+		}
+		premises.push_back(s->identifier);
+		bool contradiction = extendHyperresolvent(nucleus, satellites,
+			position + 1, extended, premises, supported || s->supported,
+			initial || s->clause_type == ClauseType::INITIAL,
+			resolved_clauses);
+		premises.pop_back();
+		delete extended;
+		if(contradiction)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ClauseIndex::isSubsumedDisjunction(ClauseType type,
+	const std::vector<Literal*>& literals)
+{
+	if(literals.empty())
+	{
+		// only a contradiction could subsume the empty disjunction
+		return false;
+	}
+	std::list<ClauseType>* clause_types = new std::list<ClauseType>
+		{ClauseType::UNIVERSAL};
+	if(type == ClauseType::INITIAL)
+	{
+		clause_types->push_back(ClauseType::INITIAL);
+	}
+	std::list<IndexNode*>* filtered_clauses = filterByMaxLiteralAndLength(
+		literals.back()->rank, literals.size(), clause_types);
+	LiteralMask literals_mask = LiteralList::use_literal_masks ?
+		LiteralList::literalsMask(literals) : 0;
+	bool subsumed = false;
+	std::list<IndexNode*>::iterator filtered_it = filtered_clauses->begin();
+	std::list<IndexNode*>::iterator filtered_end = filtered_clauses->end();
+	while(!subsumed && filtered_it != filtered_end)
+	{
+		for(IndexNode* node = *filtered_it; !subsumed && node != nullptr;
+			node = node->next)
+		{
+			subsumed = !node->clause->dead &&
+				node->clause->right->isSubsetOf(literals, literals_mask);
+		}
+		filtered_it++;
+	}
+	delete filtered_clauses;
+	return subsumed;
+}
+
+IndexNode** ClauseIndex::updateCounts(Clause* clause, int change,
+	int passive_change, int* index)
+{
+	int* feature_vector = clause->calculateFeatures();
+	InternalNode** node = root;
+	int i = 0;
+	// traverse the tree until the penultimate level is reached
+	while(i < feature_count - 2)
+	{
+		node[feature_vector[i]]->count += change;
+		node[feature_vector[i]]->passive_count += passive_change;
+		node = node[feature_vector[i]]->next_node;
+		i++;
+	}
+	node[feature_vector[i]]->count += change;
+	node[feature_vector[i]]->passive_count += passive_change;
+	InternalNodeTerminal* terminal_node =
+		static_cast<InternalNodeTerminal*>(node[feature_vector[i++]]);
+	*index = feature_vector[i];
+	num_clauses += change;
+	num_passive_clauses += passive_change;
+	delete[] feature_vector;
+	return terminal_node->leaves;
+}
+
+void ClauseIndex::compactIndex()
+{
+	std::for_each(dead_clauses.begin(), dead_clauses.end(),
+		[&](Clause* c)
+		{
+			removeFromIndex(c);
+		});
+	dead_clauses.clear();
+}
+
+void ClauseIndex::uncacheSubsumer(Clause* clause)
+{
+	Clause** cache_end = subsumer_cache + subsumer_cache_count;
+	Clause** cache_it = std::find(subsumer_cache, cache_end, clause);
+	if(cache_it != cache_end)
+	{
+		std::copy(cache_it + 1, cache_end, cache_it);
+		subsumer_cache_count--;
 	}
 }
 
@@ -1014,6 +1465,211 @@ void ClauseIndex::displayNextFeature(InternalNode** node, int feature,
 	}
 }
 
+IndexNode* ClauseIndex::addToList(IndexNode** leaves, int index,
+	Clause* clause)
+{
+	// store the clause in a new IndexNode at the start of the list
+	IndexNode* new_node = new IndexNode(clause, leaves[index], nullptr);
+	if(leaves[index] != nullptr)
+	{
+		leaves[index]->prev = new_node;
+	}
+	leaves[index] = new_node;
+	return new_node;
+}
+
+void ClauseIndex::removeFromList(IndexNode** leaves, int index,
+	IndexNode* node)
+{
+	IndexNode* prev = node->prev;
+	IndexNode* next = node->next;
+	if(prev == nullptr)
+	{
+		if(next == nullptr)
+		{
+			// the only node in the list
+			leaves[index] = nullptr;
+		}
+		else
+		{
+			// the first node in the list
+			next->prev = nullptr;
+			leaves[index] = next;
+		}
+	}
+	else
+	{
+		if(next == nullptr)
+		{
+			// the last node in the list
+			prev->next = nullptr;
+		}
+		else
+		{
+			// in between two nodes in the list
+			prev->next = next;
+			next->prev = prev;
+		}
+	}
+	delete node;
+}
+
+bool ClauseIndex::isDuplicateResolvent(ClauseType clause_type,
+	LiteralList* left, std::list<int>* agents,
+	const std::vector<Literal*>& right, std::vector<int>* coalition_vector)
+{
+	// the key lists each component in turn, separated by INT_MIN
+	resolvent_key.clear();
+	resolvent_key.push_back(clause_type);
+	resolvent_key.push_back(INT_MIN);
+	std::for_each(right.begin(), right.end(),
+		[&](Literal* l)
+		{
+			resolvent_key.push_back(l->rank);
+		});
+	resolvent_key.push_back(INT_MIN);
+	if(left != nullptr && left->getList() != nullptr)
+	{
+		std::for_each(left->getList()->begin(), left->getList()->end(),
+			[&](Literal* l)
+			{
+				resolvent_key.push_back(l->rank);
+			});
+	}
+	resolvent_key.push_back(INT_MIN);
+	if(agents != nullptr)
+	{
+		resolvent_key.insert(resolvent_key.end(), agents->begin(),
+			agents->end());
+	}
+	resolvent_key.push_back(INT_MIN);
+	if(coalition_vector != nullptr)
+	{
+		resolvent_key.insert(resolvent_key.end(), coalition_vector->begin(),
+			coalition_vector->end());
+	}
+
+	if(!batch_resolvents.insert(resolvent_key).second)
+	{
+		// this resolvent was already derived in this batch
+		g_batch_duplicate_resolvents++;
+		return true;
+	}
+	if(recent_fingerprints.empty())
+	{
+		// only an index that resolves needs the table
+		recent_fingerprints.assign(RECENT_RESOLVENT_MIN_TABLE_SIZE, 0);
+		recent_keys.resize(RECENT_RESOLVENT_MIN_TABLE_SIZE);
+	}
+	else if(recent_count > recent_fingerprints.size() &&
+		recent_fingerprints.size() < RECENT_RESOLVENT_MAX_TABLE_SIZE)
+	{
+		// double the table, keeping the resolvents already recorded
+		std::vector<uint64_t> fingerprints(recent_fingerprints.size() * 2, 0);
+		std::vector<std::vector<int>> keys(fingerprints.size());
+		for(std::size_t i = 0; i < recent_fingerprints.size(); i++)
+		{
+			if(recent_keys[i].empty())
+			{
+				// nothing has been recorded here
+				continue;
+			}
+			std::size_t position =
+				recent_fingerprints[i] & (fingerprints.size() - 1);
+			fingerprints[position] = recent_fingerprints[i];
+			keys[position].swap(recent_keys[i]);
+		}
+		recent_fingerprints.swap(fingerprints);
+		recent_keys.swap(keys);
+		recent_count = 0;
+	}
+	uint64_t fingerprint = ResolventKeyHash()(resolvent_key);
+	std::size_t position = fingerprint & (recent_fingerprints.size() - 1);
+	if(recent_fingerprints[position] == fingerprint &&
+		recent_keys[position] == resolvent_key)
+	{
+		// this resolvent was derived by an earlier call to resolve
+		g_recent_duplicate_resolvents++;
+		return true;
+	}
+	recent_fingerprints[position] = fingerprint;
+	recent_keys[position].assign(resolvent_key.begin(), resolvent_key.end());
+	recent_count++;
+	return false;
+}
+
+bool ClauseIndex::addResolvent(ClauseType clause_type, LiteralList* left,
+	std::list<int>* agents, std::vector<int>* coalition_vector,
+	const bool copy, Clause* clause, Clause* index_clause,
+	Literal* resolved_literal, InferenceRule rule,
+	std::list<Clause*>* resolved_clauses)
+{
+	if(isDuplicateResolvent(clause_type, left, agents, resolvent_literals,
+		coalition_vector))
+	{
+		// this resolvent has already been derived
+		if(!copy)
+		{
+			delete left;
+			delete agents;
+			delete coalition_vector;
+		}
+		return false;
+	}
+	bool checked = false;
+	if(left == nullptr)
+	{
+		if(isForwardSubsumedResolvent(clause_type, &checked))
+		{
+			return false;
+		}
+		// a universal or initial resolvent
+		left = new LiteralList();
+		agents = new std::list<int>();
+	}
+	else if(copy)
+	{
+		left = new LiteralList(*left);
+		agents = new std::list<int>(*agents);
+		coalition_vector = new std::vector<int>(*coalition_vector);
+	}
+	Clause* resolvent = new Clause(left, agents,
+		new LiteralList(resolvent_literals), clause_type,
+		new Justification(clause->identifier, index_clause->identifier,
+			resolved_literal, rule), coalition_vector, false);
+	if(checked)
+	{
+		resolvent->subsumption_checked_index = this;
+	}
+	if(resolvent->size() == 0)
+	{
+		// a contradiction has been derived
+		g_contradiction = resolvent;
+		return true;
+	}
+	resolved_clauses->push_back(resolvent);
+	return false;
+}
+
+bool ClauseIndex::isForwardSubsumedResolvent(ClauseType clause_type,
+	bool* checked)
+{
+	/* the activity heuristic bumps the literals of every resolvent, so
+	   resolvents are then only subsumed once they are built */
+	if(!g_forward_subsumption || g_activity_selector != nullptr)
+	{
+		return false;
+	}
+	*checked = true;
+	if(!isSubsumedDisjunction(clause_type, resolvent_literals))
+	{
+		return false;
+	}
+	// the resolvent would be forward subsumed so no clause is built for it
+	g_forward_subsumed_count++;
+	return true;
+}
+
 void ClauseIndex::displayTautology(Clause* clause_1, Clause* clause_2)
 {
 	std::cout << DIVIDER_2;
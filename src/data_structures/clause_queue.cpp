@@ -0,0 +1,78 @@
+/*==============================================================================
+	File			: clause_queue.cpp
+	Author			: Paul Gainer
+	Created			: 18/10/2026
+	Last modified	: 18/10/2026
+==============================================================================*/
+/*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+/==============================================================================\
+|   Copyright (C) 2014 Paul Gainer, University of Liverpool                    |
+|                                                                              |
+|   This file is part of CLProver++.                                           |
+|                                                                              |
+|   CLProver++ is free software; you can redistribute it and/or modify it      |
+|   under the terms of the GNU General Public License as published by the Free |
+|   Software Foundation, either version 3 of the License; or (at your option)  |
+|   any later version.                                                         |
+|                                                                              |
+|   CLProver++ is distributed in the hope that it will be useful, but WITHOUT  |
+|   ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or      |
+|   FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for   |
+|   more details.                                                              |
+|                                                                              |
+|   You should have received a copy of the GNU General Public License along    |
+|   with CLProver++. If not, see <http:/www.gnu.org/licenses/>.                |
+|                                                                              |
+\==============================================================================/
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+#include <algorithm>
+
+#include "data_structures/clause.h"
+#include "data_structures/clause_queue.h"
+
+/*==============================================================================
+	Public Functions
+==============================================================================*/
+Clause* ClauseQueue::pop()
+{
+	mergePending();
+	Clause* clause = queue.front();
+	queue.pop_front();
+	return clause;
+}
+
+void ClauseQueue::removeDead()
+{
+	mergePending();
+	queue.erase(std::remove_if(queue.begin(), queue.end(),
+		[](Clause* c)
+		{
+			return c->isDead();
+		}), queue.end());
+}
+
+/*==============================================================================
+	Private Functions
+==============================================================================*/
+void ClauseQueue::mergePending()
+{
+	if(pending.empty())
+	{
+		return;
+	}
+	auto by_identifier =
+		[](const Clause* this_clause, const Clause* that_clause)
+		{
+			return this_clause->getIdentifier() < that_clause->getIdentifier();
+		};
+	std::sort(pending.begin(), pending.end(), by_identifier);
+	// only the queued clauses newer than the oldest pending clause are merged
+	auto merge_begin = std::upper_bound(queue.begin(), queue.end(),
+		pending.front(), by_identifier);
+	unsigned int merge_offset = merge_begin - queue.begin();
+	unsigned int pending_offset = queue.size();
+	queue.insert(queue.end(), pending.begin(), pending.end());
+	std::inplace_merge(queue.begin() + merge_offset,
+		queue.begin() + pending_offset, queue.end(), by_identifier);
+	pending.clear();
+}
@@ -2,7 +2,7 @@
 	File			: literal.cpp
 	Author			: Paul Gainer
 	Created			: 16/06/2014
-	Last modified	: 16/09/2014
+	Last modified	: 18/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -42,7 +42,8 @@ int Literal::next_literal_rank = 1;
 ==============================================================================*/
 Literal::Literal(const std::string& identifier, const bool polarity,
 	Literal* complementary_literal): is_used(false), identifier(identifier),
-		polarity(polarity), complementary_literal(complementary_literal)
+		polarity(polarity), complementary_literal(complementary_literal),
+		occurrences(0)
 {
 	if(g_increment_literal_ranks)
 	{
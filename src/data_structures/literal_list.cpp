@@ -2,7 +2,7 @@
 	File			: literal_list.cpp
 	Author			: Paul Gainer
 	Created			: 23/06/2014
-	Last modified	: 16/09/2014
+	Last modified	: 19/10/2026
 ==============================================================================*/
 /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
 /==============================================================================\
@@ -33,6 +33,12 @@
 
 #include "clprover/define.h"
 
+/*==========================================================================
+	Public Static Member Variables
+==========================================================================*/
+bool LiteralList::use_literal_masks = false;
+bool LiteralList::exact_literal_masks = false;
+
 /*==========================================================================
 	Public Functions
 ==========================================================================*/
@@ -71,10 +77,42 @@ LiteralList* LiteralList::removeMaximalLiteral()
 		std::list<Literal*>* new_list = new std::list<Literal*>(*list);
 		new_list->pop_back();
 		new_literal_list->list = new_list;
+		if(exact_literal_masks)
+		{
+			new_literal_list->mask = mask & ~literalBit(list->back());
+		}
+		else if(use_literal_masks)
+		{
+			// another literal may share the bit of the removed literal
+			new_literal_list->calculateMask();
+		}
 		return new_literal_list;
 	}
 }
 
+LiteralList* LiteralList::removeLiteral(Literal* literal)
+{
+	LiteralList* new_literal_list = new LiteralList();
+	if(list == nullptr || list->size() <= 1)
+	{
+		// the list is empty so return the new empty one
+		return new_literal_list;
+	}
+	std::list<Literal*>* new_list = new std::list<Literal*>(*list);
+	new_list->remove(literal);
+	new_literal_list->list = new_list;
+	if(exact_literal_masks)
+	{
+		new_literal_list->mask = mask & ~literalBit(literal);
+	}
+	else if(use_literal_masks)
+	{
+		// another literal may share the bit of the removed literal
+		new_literal_list->calculateMask();
+	}
+	return new_literal_list;
+}
+
 void LiteralList::addLiteral(Literal* new_literal)
 {
 	if(list == nullptr)
@@ -93,12 +131,39 @@ void LiteralList::addLiteral(Literal* new_literal)
 	if((here == list->end()) || (*here != new_literal))
 	{
 		list->insert(here, new_literal);
+		if(use_literal_masks)
+		{
+			mask |= literalBit(new_literal);
+		}
 	}
 	return;
 }
 
+void LiteralList::sortByRank()
+{
+	if(list != nullptr)
+	{
+		list->sort([](Literal* this_literal, Literal* that_literal)
+			{
+				return this_literal->rank < that_literal->rank;
+			});
+	}
+}
+
 bool LiteralList::isSubsetOf(LiteralList* that)
 {
+	if(use_literal_masks)
+	{
+		// every literal in this list must also be in the given list
+		if((mask & ~that->mask) != 0)
+		{
+			return false;
+		}
+		if(exact_literal_masks)
+		{
+			return true;
+		}
+	}
 	// the empty set is a subset of any set
 	if(list == nullptr)
 	{
@@ -124,8 +189,49 @@ bool LiteralList::isSubsetOf(LiteralList* that)
 		});
 }
 
+bool LiteralList::isSubsetOf(const std::vector<Literal*>& literals,
+	const LiteralMask literals_mask)
+{
+	if(use_literal_masks)
+	{
+		// every literal in this list must also be in the given literals
+		if((mask & ~literals_mask) != 0)
+		{
+			return false;
+		}
+		if(exact_literal_masks)
+		{
+			return true;
+		}
+	}
+	// the empty set is a subset of any set
+	if(list == nullptr)
+	{
+		return true;
+	}
+	return std::includes(literals.begin(), literals.end(), list->begin(),
+		list->end(),
+		[](Literal* this_literal, Literal* that_literal)
+		{
+			return this_literal->rank < that_literal->rank;
+		});
+}
+
 bool LiteralList::isSubsetOfNegationOf(LiteralList* that)
 {
+	if(use_literal_masks)
+	{
+		/* every literal in this list must be the complement of a literal in
+		   the given list */
+		if((mask & ~complementMask(that->mask)) != 0)
+		{
+			return false;
+		}
+		if(exact_literal_masks)
+		{
+			return true;
+		}
+	}
 	// the empty set is a subset of any set
 	if(list == nullptr)
 	{
@@ -136,21 +242,101 @@ bool LiteralList::isSubsetOfNegationOf(LiteralList* that)
 	{
 		return false;
 	}
-	/* this list has a greater maximal literal and as such cannot be a subset
-		 of the given list */
-	else if(list->back()->rank > that->list->back()->rank)
+	/* this list has a greater maximal literal than the negation of the given
+	   list and as such cannot be a subset of it */
+	else if(list->back()->rank >
+		that->list->back()->complementary_literal->rank)
 	{
 		return false;
 	}
-	// return true if the negation of the given list contains this list
-	return std::includes(that->list->begin(), that->list->end(), list->begin(),
-		list->end(),
-		[](Literal* this_literal, Literal* that_literal)
+	/* return true if the negation of the given list contains this list, the
+	   negation of a list is still ordered by rank */
+	std::list<Literal*>::iterator that_it = that->list->begin();
+	std::list<Literal*>::iterator that_end = that->list->end();
+	return std::all_of(list->begin(), list->end(),
+		[&](Literal* this_literal)
 		{
-			return this_literal->rank < that_literal->complementary_literal->rank;
+			while(that_it != that_end &&
+				(*that_it)->complementary_literal->rank < this_literal->rank)
+			{
+				that_it++;
+			}
+			return that_it != that_end &&
+				(*that_it)->complementary_literal == this_literal;
 		});
 }
 
+Literal* LiteralList::subsumptionResolves(LiteralList* that)
+{
+	if(list == nullptr || that->list == nullptr)
+	{
+		// the empty set is a subset of any set so nothing can be resolved
+		return nullptr;
+	}
+	if(use_literal_masks)
+	{
+		/* exactly one literal must be missing from the given list, though
+		   with shared bits a missing literal need not show in the bitmask... */
+		LiteralMask missing = mask & ~that->mask;
+		if((missing == 0 && exact_literal_masks) ||
+			(missing & (missing - 1)) != 0 ||
+			(missing != 0 && (complementMask(missing) & that->mask) == 0))
+		{
+			// ...and its complement must be in the given list
+			return nullptr;
+		}
+		if(exact_literal_masks)
+		{
+			std::list<Literal*>::iterator it = std::find_if(list->begin(),
+				list->end(),
+				[&](Literal* l)
+				{
+					return literalBit(l) == missing;
+				});
+			return (*it)->complementary_literal;
+		}
+	}
+	// find the literal in this list that is missing from the given list
+	Literal* missing = nullptr;
+	std::list<Literal*>::iterator that_it = that->list->begin();
+	std::list<Literal*>::iterator that_end = that->list->end();
+	for(Literal* this_literal : *list)
+	{
+		while(that_it != that_end && (*that_it)->rank < this_literal->rank)
+		{
+			that_it++;
+		}
+		if(that_it == that_end || *that_it != this_literal)
+		{
+			if(missing != nullptr)
+			{
+				// more than one literal is missing
+				return nullptr;
+			}
+			missing = this_literal;
+		}
+	}
+	if(missing == nullptr || std::find(that->list->begin(), that->list->end(),
+		missing->complementary_literal) == that->list->end())
+	{
+		return nullptr;
+	}
+	return missing->complementary_literal;
+}
+
+void LiteralList::calculateMask()
+{
+	mask = 0;
+	if(list != nullptr)
+	{
+		std::for_each(list->begin(), list->end(),
+			[&](Literal* l)
+			{
+				mask |= literalBit(l);
+			});
+	}
+}
+
 /*==========================================================================
 	Public Static Functions
 ==========================================================================*/
@@ -173,6 +359,18 @@ std::pair<LiteralList*, const bool>* LiteralList::unionLiterals(
 		return new std::pair<LiteralList*, const bool>(literal_list_1,
 			false);
 	}
+	if(exact_literal_masks)
+	{
+		if((literal_list_1->mask & complementMask(literal_list_2->mask)) != 0)
+		{
+			/* a literal in one list has its complement in the other list, so
+			   there is no need to build the union */
+			delete literal_list_1;
+			delete literal_list_2;
+			return new std::pair<LiteralList*, const bool>(new LiteralList(),
+				true);
+		}
+	}
 	std::list<Literal*>* new_list = new std::list<Literal*>();
 	bool is_tautology = false;
 	std::set_union(list_1->begin(), list_1->end(), list_2->begin(),
@@ -185,11 +383,98 @@ std::pair<LiteralList*, const bool>* LiteralList::unionLiterals(
 				}
 				return this_literal->rank < that_literal->rank;
 			});
+	LiteralMask mask_union = literal_list_1->mask | literal_list_2->mask;
 	delete literal_list_1;
 	delete literal_list_2;
 	LiteralList* new_literal_list = new LiteralList();
 	new_literal_list->list = new_list;
+	new_literal_list->mask = mask_union;
 	return new std::pair<LiteralList*, const bool>(new_literal_list,
 		is_tautology);
 }
 
+LiteralMask LiteralList::literalsMask(const std::vector<Literal*>& literals)
+{
+	LiteralMask literals_mask = 0;
+	std::for_each(literals.begin(), literals.end(),
+		[&](Literal* l)
+		{
+			literals_mask |= literalBit(l);
+		});
+	return literals_mask;
+}
+
+bool LiteralList::resolvedUnion(LiteralList* literal_list_1,
+	Literal* literal_1, LiteralList* literal_list_2, Literal* literal_2,
+	std::vector<Literal*>& literals)
+{
+	literals.clear();
+	if(exact_literal_masks &&
+		((literal_list_1->mask & ~literalBit(literal_1)) &
+		complementMask(literal_list_2->mask & ~literalBit(literal_2))) != 0)
+	{
+		/* a literal in one list has its complement in the other list, so
+		   there is no need to merge the lists */
+		return true;
+	}
+	std::list<Literal*>* list_1 = literal_list_1->list;
+	std::list<Literal*>* list_2 = literal_list_2->list;
+	std::list<Literal*>::iterator it_1 = list_1->begin();
+	std::list<Literal*>::iterator it_2 = list_2->begin();
+	// skip the literals resolved upon
+	auto skip = [&]()
+		{
+			if(it_1 != list_1->end() && *it_1 == literal_1)
+			{
+				it_1++;
+			}
+			if(it_2 != list_2->end() && *it_2 == literal_2)
+			{
+				it_2++;
+			}
+		};
+	bool is_tautology = false;
+	// the same comparisons as the set union in unionLiterals
+	auto less = [&](Literal* this_literal, Literal* that_literal)
+		{
+			if(this_literal->complementary_literal == that_literal)
+			{
+				is_tautology = true;
+			}
+			return this_literal->rank < that_literal->rank;
+		};
+	skip();
+	while(it_1 != list_1->end() && it_2 != list_2->end())
+	{
+		if(less(*it_1, *it_2))
+		{
+			literals.push_back(*it_1++);
+		}
+		else if(less(*it_2, *it_1))
+		{
+			literals.push_back(*it_2++);
+		}
+		else
+		{
+			literals.push_back(*it_1++);
+			it_2++;
+		}
+		skip();
+	}
+	for(; it_1 != list_1->end(); it_1++)
+	{
+		if(*it_1 != literal_1)
+		{
+			literals.push_back(*it_1);
+		}
+	}
+	for(; it_2 != list_2->end(); it_2++)
+	{
+		if(*it_2 != literal_2)
+		{
+			literals.push_back(*it_2);
+		}
+	}
+	return is_tautology;
+}
+